@@ -0,0 +1,456 @@
+#include "../lib/number_flat.h"
+#if defined(BIGINT_FILE_FORMAT)
+#include "../lib/number_file.h"
+
+#include <cstdio>
+#include <filesystem>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Every benchmark but BM_RunningSum takes two arguments: the bit length of the left
+// operand (32 for small values, 239 for values near 2^239) and the shift of both operands.
+// The right operand has about half as many bits, so division produces a quotient of a
+// useful size.
+// Scalar benchmarks time one call at a time over a small ring of operands; array
+// benchmarks run a whole column per iteration and report items per second.
+//
+//   ./number_bench --benchmark_filter=Array --benchmark_format=json --benchmark_out=new.json
+//   compare.py benchmarks old.json new.json
+inline constexpr std::size_t kScalarCount = 64;
+inline constexpr std::size_t kArrayCount = 4096;
+inline constexpr std::size_t kRunningSumCount = 10'000'000;
+inline constexpr uint32_t kShiftAmount = 17;
+
+void _operandArgs(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"bits", "shift"});
+    bench->ArgsProduct({{32, 239}, {0, 13, 244, static_cast<int64_t>(UINT32_MAX)}});
+}
+
+// Random value with exactly the given number of bits, parsed from hex like any caller's input.
+uint239_t _randomOperand(std::mt19937_64& rng, int bits, uint32_t shift) {
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+    int top_bits = (bits - 1) % 4 + 1;
+    uint64_t top_bit = 1ULL << (top_bits - 1);
+    std::string hex(1, kHexDigits[top_bit | (rng() & (top_bit - 1))]);
+    for (int i = top_bits; i < bits; i += 4) {
+        hex += kHexDigits[rng() % 16];
+    }
+    uint239_t value;
+    FromChars(hex, value, shift, 16);
+    return value;
+}
+
+template <class Operand>
+struct _operands {
+    std::vector<Operand> lhs;
+    std::vector<Operand> rhs;
+
+    _operands(const benchmark::State& state, std::size_t count) {
+        std::mt19937_64 rng(239);
+        int bits = static_cast<int>(state.range(0));
+        uint32_t shift = static_cast<uint32_t>(state.range(1));
+        for (std::size_t i = 0; i < count; ++i) {
+            lhs.push_back(Operand(_randomOperand(rng, bits, shift)));
+            rhs.push_back(Operand(_randomOperand(rng, bits / 2 + 1, shift)));
+        }
+    }
+};
+
+// The second parameter only selects the operand type: uint239_t or uint239_work.
+template <class Operand, class Op>
+void BM_Scalar(benchmark::State& state, Operand, Op op) {
+    _operands<Operand> operands(state, kScalarCount);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto result = op(operands.lhs[i], operands.rhs[i]);
+        benchmark::DoNotOptimize(result);
+        i = (i + 1) % kScalarCount;
+    }
+}
+
+template <class Operand, class Op>
+void BM_Array(benchmark::State& state, Operand, Op op) {
+    _operands<Operand> operands(state, kArrayCount);
+    std::vector<decltype(op(operands.lhs[0], operands.rhs[0]))> results(kArrayCount);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kArrayCount; ++i) {
+            results[i] = op(operands.lhs[i], operands.rhs[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kArrayCount));
+}
+
+// The second and third parameters only select the column types: the operands and the results.
+template <class Operand, class Result, class Batch>
+void BM_Batch(benchmark::State& state, Operand, Result, Batch batch) {
+    _operands<Operand> operands(state, kArrayCount);
+    std::vector<Result> results(kArrayCount);
+    for (auto _ : state) {
+        batch(operands.lhs, operands.rhs, results);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kArrayCount));
+}
+
+// Reduces the columns to one value per iteration; most reductions only read the left one.
+template <class Reduce>
+void BM_Reduce(benchmark::State& state, Reduce reduce) {
+    _operands<uint239_t> operands(state, kArrayCount);
+    for (auto _ : state) {
+        uint239_t acc = reduce(operands.lhs, operands.rhs);
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kArrayCount));
+}
+
+// Sums kRunningSumCount values into one accumulator: a column far larger than the caches,
+// the loop the compound operators and uint239_work are meant for. The values are 32-bit
+// with shifts below 4096 and are built once for all the cases.
+const std::vector<uint239_t>& _runningSumValues() {
+    static const std::vector<uint239_t> values = [] {
+        std::mt19937_64 rng(239);
+        std::vector<uint239_t> result;
+        result.reserve(kRunningSumCount);
+        for (std::size_t i = 0; i < kRunningSumCount; ++i) {
+            result.push_back(FromInt(static_cast<uint32_t>(rng()), static_cast<uint32_t>(rng() % 4096)));
+        }
+        return result;
+    }();
+    return values;
+}
+
+template <class Reduce>
+void BM_RunningSum(benchmark::State& state, Reduce reduce) {
+    const std::vector<uint239_t>& values = _runningSumValues();
+    for (auto _ : state) {
+        uint239_t acc = reduce(values);
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRunningSumCount));
+}
+
+#define BIGINT_BENCHMARK(name, operand, op)                                 \
+    BENCHMARK_CAPTURE(BM_Scalar, name, operand{}, op)->Apply(_operandArgs); \
+    BENCHMARK_CAPTURE(BM_Array, name, operand{}, op)->Apply(_operandArgs)
+
+// Binary operators on uint239_t.
+auto kAdd = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs + rhs; };
+auto kSub = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs - rhs; };
+auto kMul = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs * rhs; };
+auto kDiv = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs / rhs; };
+auto kMod = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs % rhs; };
+auto kDivMod = [](const uint239_t& lhs, const uint239_t& rhs) { return DivMod(lhs, rhs); };
+auto kMulWide = [](const uint239_t& lhs, const uint239_t& rhs) { return MulWide(lhs, rhs); };
+auto kMulHigh = [](const uint239_t& lhs, const uint239_t& rhs) { return MulHigh(lhs, rhs); };
+auto kMulAdd = [](const uint239_t& lhs, const uint239_t& rhs) { return MulAdd(lhs, rhs, lhs); };
+auto kMulThenAdd = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs * rhs + lhs; };
+auto kPow = [](const uint239_t& lhs, const uint239_t&) { return Pow(lhs, 5); };
+auto kGcd = [](const uint239_t& lhs, const uint239_t& rhs) { return Gcd(lhs, rhs); };
+auto kExtGcd = [](const uint239_t& lhs, const uint239_t& rhs) { return ExtGcd(lhs, rhs); };
+auto kLcm = [](const uint239_t& lhs, const uint239_t& rhs) { return Lcm(lhs, rhs); };
+auto kIsqrt = [](const uint239_t& lhs, const uint239_t&) { return Isqrt(lhs); };
+auto kShiftLeft = [](const uint239_t& lhs, const uint239_t&) { return lhs << kShiftAmount; };
+auto kShiftRight = [](const uint239_t& lhs, const uint239_t&) { return lhs >> kShiftAmount; };
+auto kEqual = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs == rhs; };
+auto kNotEqual = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs != rhs; };
+auto kLess = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs < rhs; };
+auto kGreater = [](const uint239_t& lhs, const uint239_t& rhs) { return lhs > rhs; };
+auto kGetShift = [](const uint239_t& lhs, const uint239_t&) { return GetShift(lhs); };
+auto kThreeWay = [](const uint239_t& lhs, const uint239_t& rhs) {
+    std::weak_ordering order = lhs <=> rhs;
+    return (order > 0) - (order < 0);
+};
+auto kSortKey = [](const uint239_t& lhs, const uint239_t&) { return SortKey(lhs); };
+
+BIGINT_BENCHMARK(add, uint239_t, kAdd);
+BIGINT_BENCHMARK(sub, uint239_t, kSub);
+BIGINT_BENCHMARK(mul, uint239_t, kMul);
+BIGINT_BENCHMARK(div, uint239_t, kDiv);
+BIGINT_BENCHMARK(mod, uint239_t, kMod);
+BIGINT_BENCHMARK(divmod, uint239_t, kDivMod);
+BIGINT_BENCHMARK(mul_wide, uint239_t, kMulWide);
+BIGINT_BENCHMARK(mul_high, uint239_t, kMulHigh);
+BIGINT_BENCHMARK(mul_add, uint239_t, kMulAdd);
+BIGINT_BENCHMARK(mul_then_add, uint239_t, kMulThenAdd);
+BIGINT_BENCHMARK(pow, uint239_t, kPow);
+BIGINT_BENCHMARK(gcd, uint239_t, kGcd);
+BIGINT_BENCHMARK(ext_gcd, uint239_t, kExtGcd);
+BIGINT_BENCHMARK(lcm, uint239_t, kLcm);
+BIGINT_BENCHMARK(isqrt, uint239_t, kIsqrt);
+BIGINT_BENCHMARK(shift_left, uint239_t, kShiftLeft);
+BIGINT_BENCHMARK(shift_right, uint239_t, kShiftRight);
+BIGINT_BENCHMARK(equal, uint239_t, kEqual);
+BIGINT_BENCHMARK(not_equal, uint239_t, kNotEqual);
+BIGINT_BENCHMARK(less, uint239_t, kLess);
+BIGINT_BENCHMARK(greater, uint239_t, kGreater);
+BIGINT_BENCHMARK(get_shift, uint239_t, kGetShift);
+BIGINT_BENCHMARK(three_way, uint239_t, kThreeWay);
+BIGINT_BENCHMARK(sort_key, uint239_t, kSortKey);
+
+// Compound assignment, on a copy of the left operand.
+auto kAddAssign = [](uint239_t lhs, const uint239_t& rhs) { return lhs += rhs; };
+auto kSubAssign = [](uint239_t lhs, const uint239_t& rhs) { return lhs -= rhs; };
+auto kMulAssign = [](uint239_t lhs, const uint239_t& rhs) { return lhs *= rhs; };
+auto kDivAssign = [](uint239_t lhs, const uint239_t& rhs) { return lhs /= rhs; };
+auto kModAssign = [](uint239_t lhs, const uint239_t& rhs) { return lhs %= rhs; };
+auto kShiftLeftAssign = [](uint239_t lhs, const uint239_t&) { return lhs <<= kShiftAmount; };
+auto kShiftRightAssign = [](uint239_t lhs, const uint239_t&) { return lhs >>= kShiftAmount; };
+
+BIGINT_BENCHMARK(add_assign, uint239_t, kAddAssign);
+BIGINT_BENCHMARK(sub_assign, uint239_t, kSubAssign);
+BIGINT_BENCHMARK(mul_assign, uint239_t, kMulAssign);
+BIGINT_BENCHMARK(div_assign, uint239_t, kDivAssign);
+BIGINT_BENCHMARK(mod_assign, uint239_t, kModAssign);
+BIGINT_BENCHMARK(shift_left_assign, uint239_t, kShiftLeftAssign);
+BIGINT_BENCHMARK(shift_right_assign, uint239_t, kShiftRightAssign);
+
+// Conversions.
+auto kFromInt = [](const uint239_t& lhs, const uint239_t&) { return FromInt(lhs.data[34], kShiftAmount); };
+auto kToString = [](const uint239_t& lhs, const uint239_t&) { return ToString(lhs); };
+auto kToHexString = [](const uint239_t& lhs, const uint239_t&) { return ToString(lhs, 16); };
+
+BIGINT_BENCHMARK(from_int, uint239_t, kFromInt);
+BIGINT_BENCHMARK(to_string, uint239_t, kToString);
+BIGINT_BENCHMARK(to_hex_string, uint239_t, kToHexString);
+
+auto kHash = [](const uint239_t& lhs, const uint239_t&) { return std::hash<uint239_t>{}(lhs); };
+
+BIGINT_BENCHMARK(hash, uint239_t, kHash);
+
+template <int Base>
+void BM_FromChars(benchmark::State& state) {
+    _operands<uint239_t> operands(state, kScalarCount);
+    std::vector<std::string> strings;
+    for (const uint239_t& value : operands.lhs) {
+        strings.push_back(ToString(value, Base));
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        uint239_t value;
+        benchmark::DoNotOptimize(FromChars(strings[i], value, kShiftAmount, Base));
+        benchmark::DoNotOptimize(value);
+        i = (i + 1) % kScalarCount;
+    }
+}
+
+BENCHMARK(BM_FromChars<10>)->Apply(_operandArgs);
+BENCHMARK(BM_FromChars<16>)->Apply(_operandArgs);
+
+void BM_FromString(benchmark::State& state) {
+    _operands<uint239_t> operands(state, kScalarCount);
+    std::vector<std::string> strings;
+    for (const uint239_t& value : operands.lhs) {
+        strings.push_back(ToString(value));
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(FromString(strings[i].c_str(), kShiftAmount));
+        i = (i + 1) % kScalarCount;
+    }
+}
+
+BENCHMARK(BM_FromString)->Apply(_operandArgs);
+
+// The I-Endian codec through uint239_work, which goes to the kernel tier picked at startup.
+auto kDecode = [](const uint239_t& lhs, const uint239_t&) { return uint239_work(lhs); };
+auto kEncode = [](const uint239_work& lhs, const uint239_work&) { return lhs.Pack(); };
+
+BIGINT_BENCHMARK(decode, uint239_t, kDecode);
+BIGINT_BENCHMARK(encode, uint239_work, kEncode);
+
+// The same operators on the decoded working type.
+auto kWorkAdd = [](const uint239_work& lhs, const uint239_work& rhs) { return lhs + rhs; };
+auto kWorkSub = [](const uint239_work& lhs, const uint239_work& rhs) { return lhs - rhs; };
+auto kWorkMul = [](const uint239_work& lhs, const uint239_work& rhs) { return lhs * rhs; };
+auto kWorkDiv = [](const uint239_work& lhs, const uint239_work& rhs) { return lhs / rhs; };
+auto kWorkMod = [](const uint239_work& lhs, const uint239_work& rhs) { return lhs % rhs; };
+auto kWorkLess = [](const uint239_work& lhs, const uint239_work& rhs) { return lhs < rhs; };
+
+BIGINT_BENCHMARK(work_add, uint239_work, kWorkAdd);
+BIGINT_BENCHMARK(work_sub, uint239_work, kWorkSub);
+BIGINT_BENCHMARK(work_mul, uint239_work, kWorkMul);
+BIGINT_BENCHMARK(work_div, uint239_work, kWorkDiv);
+BIGINT_BENCHMARK(work_mod, uint239_work, kWorkMod);
+BIGINT_BENCHMARK(work_less, uint239_work, kWorkLess);
+
+// Arithmetic modulo the odd 2^239 - 19: PowMod and MontgomeryMul run in Montgomery form.
+const uint239_mod_context kModContext(0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffed_u239);
+
+auto kAddMod = [](const uint239_t& lhs, const uint239_t& rhs) { return kModContext.AddMod(lhs, rhs); };
+auto kSubMod = [](const uint239_t& lhs, const uint239_t& rhs) { return kModContext.SubMod(lhs, rhs); };
+auto kMulMod = [](const uint239_t& lhs, const uint239_t& rhs) { return kModContext.MulMod(lhs, rhs); };
+auto kMontgomeryMul = [](const uint239_t& lhs, const uint239_t& rhs) { return kModContext.MontgomeryMul(lhs, rhs); };
+auto kPowMod = [](const uint239_t& lhs, const uint239_t& rhs) { return kModContext.PowMod(lhs, rhs); };
+auto kInvMod = [](const uint239_t& lhs, const uint239_t&) { return kModContext.InvMod(lhs); };
+
+BIGINT_BENCHMARK(add_mod, uint239_t, kAddMod);
+BIGINT_BENCHMARK(sub_mod, uint239_t, kSubMod);
+BIGINT_BENCHMARK(mul_mod, uint239_t, kMulMod);
+BIGINT_BENCHMARK(montgomery_mul, uint239_t, kMontgomeryMul);
+BIGINT_BENCHMARK(pow_mod, uint239_t, kPowMod);
+BIGINT_BENCHMARK(inv_mod, uint239_t, kInvMod);
+
+// Column kernels.
+auto kAddBatch = [](const std::vector<uint239_t>& lhs, const std::vector<uint239_t>& rhs, std::vector<uint239_t>& result) {
+    AddBatch(lhs, rhs, result);
+};
+auto kSubBatch = [](const std::vector<uint239_t>& lhs, const std::vector<uint239_t>& rhs, std::vector<uint239_t>& result) {
+    SubBatch(lhs, rhs, result);
+};
+auto kMulBatch = [](const std::vector<uint239_t>& lhs, const std::vector<uint239_t>& rhs, std::vector<uint239_t>& result) {
+    MulBatch(lhs, rhs, result);
+};
+
+auto kCompareBatch = [](const std::vector<uint239_t>& lhs, const std::vector<uint239_t>& rhs, std::vector<int8_t>& result) {
+    CompareBatch(lhs, rhs, result);
+};
+auto kDecodeBatch = [](const std::vector<uint239_t>& values, const std::vector<uint239_t>&, std::vector<uint239_work>& result) {
+    DecodeBatch(values, result);
+};
+auto kEncodeBatch = [](const std::vector<uint239_work>& values, const std::vector<uint239_work>&, std::vector<uint239_t>& result) {
+    EncodeBatch(values, result);
+};
+auto kPrefixSum = [](const std::vector<uint239_t>& values, const std::vector<uint239_t>&, std::vector<uint239_t>& result) {
+    PrefixSum(values, result);
+};
+
+BENCHMARK_CAPTURE(BM_Batch, add_batch, uint239_t{}, uint239_t{}, kAddBatch)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Batch, sub_batch, uint239_t{}, uint239_t{}, kSubBatch)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Batch, mul_batch, uint239_t{}, uint239_t{}, kMulBatch)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Batch, compare_batch, uint239_t{}, int8_t{}, kCompareBatch)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Batch, decode_batch, uint239_t{}, uint239_work{}, kDecodeBatch)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Batch, encode_batch, uint239_work{}, uint239_t{}, kEncodeBatch)->Apply(_operandArgs);
+
+auto kSumBinary = [](const std::vector<uint239_t>& values) {
+    uint239_t acc = FromInt(0, 0);
+    for (const uint239_t& value : values) {
+        acc = acc + value;
+    }
+    return acc;
+};
+auto kSumCompound = [](const std::vector<uint239_t>& values) {
+    uint239_t acc = FromInt(0, 0);
+    for (const uint239_t& value : values) {
+        acc += value;
+    }
+    return acc;
+};
+auto kSumWork = [](const std::vector<uint239_t>& values) {
+    uint239_work acc;
+    for (const uint239_t& value : values) {
+        acc += value;
+    }
+    return acc.Pack();
+};
+
+BENCHMARK_CAPTURE(BM_RunningSum, binary, kSumBinary)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RunningSum, compound, kSumCompound)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RunningSum, work, kSumWork)->Unit(benchmark::kMillisecond);
+
+// Column reductions and the prefix sum on the thread pool, with GetThreadCount() threads.
+auto kSumParallel = [](const std::vector<uint239_t>& values, const std::vector<uint239_t>&) { return Sum(values); };
+auto kProductParallel = [](const std::vector<uint239_t>& values, const std::vector<uint239_t>&) { return Product(values); };
+auto kDotProductParallel = [](const std::vector<uint239_t>& lhs, const std::vector<uint239_t>& rhs) { return DotProduct(lhs, rhs); };
+auto kMinParallel = [](const std::vector<uint239_t>& values, const std::vector<uint239_t>&) { return Min(values); };
+auto kMaxParallel = [](const std::vector<uint239_t>& values, const std::vector<uint239_t>&) { return Max(values); };
+
+BENCHMARK_CAPTURE(BM_Reduce, sum, kSumParallel)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Reduce, product, kProductParallel)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Reduce, dot_product, kDotProductParallel)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Reduce, min, kMinParallel)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Reduce, max, kMaxParallel)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Batch, prefix_sum, uint239_t{}, uint239_t{}, kPrefixSum)->Apply(_operandArgs);
+
+// Sorts a fresh copy of the left column per iteration; the copy is timed for both sorters.
+template <class Sorter>
+void BM_Sort(benchmark::State& state, Sorter sorter) {
+    _operands<uint239_t> operands(state, kArrayCount);
+    std::vector<uint239_t> values(kArrayCount);
+    for (auto _ : state) {
+        values = operands.lhs;
+        sorter(values);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kArrayCount));
+}
+
+auto kStdSort = [](std::vector<uint239_t>& values) { std::sort(values.begin(), values.end()); };
+auto kRadixSort = [](std::vector<uint239_t>& values) { Sort(values); };
+
+BENCHMARK_CAPTURE(BM_Sort, std_sort, kStdSort)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_Sort, radix_sort, kRadixSort)->Apply(_operandArgs);
+
+// Lookups in a set of the left column: the left operands hit, the right ones mostly miss.
+template <class Set, class Contains>
+void BM_SetLookup(benchmark::State& state, Set, Contains contains) {
+    _operands<uint239_t> operands(state, kArrayCount);
+    Set set;
+    for (const uint239_t& value : operands.lhs) {
+        set.insert(value);
+    }
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < kArrayCount; ++i) {
+            hits += contains(set, operands.lhs[i]) + contains(set, operands.rhs[i]);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kArrayCount * 2));
+}
+
+// uint239_flat_set spelled like the standard containers for BM_SetLookup.
+struct _flatSetAdapter : uint239_flat_set {
+    void insert(const uint239_t& value) {
+        Insert(value);
+    }
+};
+
+auto kUnorderedContains = [](const std::unordered_set<uint239_t>& set, const uint239_t& value) { return set.count(value) == 1; };
+auto kFlatContains = [](const _flatSetAdapter& set, const uint239_t& value) { return set.Contains(value); };
+
+BENCHMARK_CAPTURE(BM_SetLookup, unordered_set, std::unordered_set<uint239_t>{}, kUnorderedContains)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_SetLookup, flat_set, _flatSetAdapter{}, kFlatContains)->Apply(_operandArgs);
+
+#if defined(BIGINT_FILE_FORMAT)
+// A column file of 64 blocks read back through the mapping: Scan checks every block's
+// CRC32C, Values() hands out the mapping unchecked. Items are values per second.
+void BM_FileScan(benchmark::State& state, bool checked) {
+    _operands<uint239_t> operands(state, kArrayCount);
+    std::string path = (std::filesystem::temp_directory_path() / "bigint_bench.col").string();
+    {
+        uint239_file_writer writer(path, kArrayCount);
+        for (int block = 0; block < 64; ++block) {
+            writer.Append(operands.lhs);
+        }
+    }
+    uint239_file_reader reader(path, uint239_file_access::sequential);
+    for (auto _ : state) {
+        uint64_t bytes = 0;
+        if (checked) {
+            reader.Scan([&](std::span<const uint239_t> block) { bytes += block.back().data[0]; });
+        } else {
+            for (const uint239_t& value : reader.Values()) {
+                bytes += value.data[0];
+            }
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * reader.Size()));
+    std::remove(path.c_str());
+}
+
+BENCHMARK_CAPTURE(BM_FileScan, checked, true)->Apply(_operandArgs);
+BENCHMARK_CAPTURE(BM_FileScan, unchecked, false)->Apply(_operandArgs);
+#endif
+
+BENCHMARK_MAIN();
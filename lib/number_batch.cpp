@@ -0,0 +1,55 @@
+#include "number.h"
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+using namespace bigint_impl;
+
+namespace {
+
+bool _checkBatchSizes(std::size_t lhs_size, std::size_t rhs_size, std::size_t result_size) {
+	if (lhs_size != result_size || rhs_size != result_size) {
+		throw std::invalid_argument("uint239_t batch size mismatch");
+	}
+	return 0;
+}
+
+}  // namespace
+
+// The kernels behind these functions are picked per CPU tier, see number_kernels.cpp.
+void AddBatch(std::span<const uint239_t> lhs, std::span<const uint239_t> rhs, std::span<uint239_t> result) {
+	BIGINT_STATS_SCOPE(add_batch);
+	_checkBatchSizes(lhs.size(), rhs.size(), result.size());
+	_activeKernels->add_batch(lhs.data(), rhs.data(), result.data(), result.size());
+}
+
+void SubBatch(std::span<const uint239_t> lhs, std::span<const uint239_t> rhs, std::span<uint239_t> result) {
+	BIGINT_STATS_SCOPE(sub_batch);
+	_checkBatchSizes(lhs.size(), rhs.size(), result.size());
+	_activeKernels->sub_batch(lhs.data(), rhs.data(), result.data(), result.size());
+}
+
+void MulBatch(std::span<const uint239_t> lhs, std::span<const uint239_t> rhs, std::span<uint239_t> result) {
+	BIGINT_STATS_SCOPE(mul_batch);
+	_checkBatchSizes(lhs.size(), rhs.size(), result.size());
+	_activeKernels->mul_batch(lhs.data(), rhs.data(), result.data(), result.size());
+}
+
+void CompareBatch(std::span<const uint239_t> lhs, std::span<const uint239_t> rhs, std::span<int8_t> result) {
+	BIGINT_STATS_SCOPE(compare_batch);
+	_checkBatchSizes(lhs.size(), rhs.size(), result.size());
+	_activeKernels->compare_batch(lhs.data(), rhs.data(), result.data(), result.size());
+}
+
+void DecodeBatch(std::span<const uint239_t> values, std::span<uint239_work> result) {
+	BIGINT_STATS_SCOPE(decode_batch);
+	_checkBatchSizes(values.size(), values.size(), result.size());
+	_activeKernels->decode_batch(values.data(), result.data(), result.size());
+}
+
+void EncodeBatch(std::span<const uint239_work> values, std::span<uint239_t> result) {
+	BIGINT_STATS_SCOPE(encode_batch);
+	_checkBatchSizes(values.size(), values.size(), result.size());
+	_activeKernels->encode_batch(values.data(), result.data(), result.size());
+}
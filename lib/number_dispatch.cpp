@@ -0,0 +1,85 @@
+#include "number.h"
+
+#include <cstdlib>
+#include <cstring>
+
+using namespace bigint_impl;
+
+// Every tier is number_kernels.cpp compiled with the flags listed in lib/CMakeLists.txt.
+// The table starts out as the generic one, which is constant-initialised, so arithmetic
+// in other static initialisers works before the tier below has been selected.
+namespace bigint_impl {
+
+namespace bigint_generic {
+extern const _kernelTable kKernels;
+}
+
+#if defined(BIGINT_X86_TIERS)
+namespace bigint_bmi2 {
+extern const _kernelTable kKernels;
+}
+
+namespace bigint_avx2 {
+extern const _kernelTable kKernels;
+}
+
+namespace bigint_avx512 {
+extern const _kernelTable kKernels;
+}
+#endif
+
+}
+
+const _kernelTable* bigint_impl::_activeKernels = &bigint_generic::kKernels;
+
+namespace {
+
+// Tiers from the weakest; a tier is usable when the CPU has every feature it was built for.
+struct _kernelTier {
+	const _kernelTable* kernels;
+	bool supported;
+};
+
+int _listKernelTiers(_kernelTier tiers[]) {
+	int count = 0;
+	tiers[count++] = {&bigint_generic::kKernels, true};
+#if defined(BIGINT_X86_TIERS)
+	__builtin_cpu_init();
+	bool bmi2 = __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2");
+	bool avx2 = bmi2 && __builtin_cpu_supports("avx2");
+	bool avx512 = avx2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+	              __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl");
+	tiers[count++] = {&bigint_bmi2::kKernels, bmi2};
+	tiers[count++] = {&bigint_avx2::kKernels, avx2};
+	tiers[count++] = {&bigint_avx512::kKernels, avx512};
+#endif
+	return count;
+}
+
+// BIGINT_CPU_TIER=generic|bmi2|avx2|avx512 caps the tier; a tier the CPU lacks falls back
+// to the best one below it, and an unknown name is ignored.
+const _kernelTable* _selectKernels() {
+	_kernelTier tiers[4];
+	int count = _listKernelTiers(tiers);
+	int limit = count - 1;
+	const char* forced = std::getenv("BIGINT_CPU_TIER");
+	if (forced != nullptr) {
+		for (int i = 0; i < count; ++i) {
+			if (std::strcmp(forced, tiers[i].kernels->name) == 0) {
+				limit = i;
+			}
+		}
+	}
+	while (!tiers[limit].supported) {
+		--limit;
+	}
+	return tiers[limit].kernels;
+}
+
+const bool _kernelsSelected = (_activeKernels = _selectKernels(), true);
+
+}  // namespace
+
+const char* GetKernelTier() {
+	return _activeKernels->name;
+}
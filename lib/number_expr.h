@@ -0,0 +1,214 @@
+#pragma once
+// Opt-in expression templates. Expr(a) wraps a value in a lazy node; +, -, *, << and >>
+// with a node on either side build a bigger node, and a formula is evaluated only when it
+// is converted to uint239_t, with one decode per leaf, one fused pass over the limbs and
+// one encode: uint239_t r = Expr(a) * b + c. The operators of number.h on two plain
+// uint239_t values stay eager whether or not this header is included. Comparison,
+// division and the compound operators materialise an expression operand first.
+#include "number.h"
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+struct uint239_add_op {};
+struct uint239_sub_op {};
+struct uint239_mul_op {};
+
+// Every node is held by value, leaves included, so a node stored in auto stays valid
+// after the values it was built from are gone, temporaries among them.
+struct uint239_leaf {
+	uint239_t value;
+
+	constexpr operator uint239_t() const {
+		return value;
+	}
+};
+
+template <class Op, class Lhs, class Rhs>
+struct uint239_expr {
+	Lhs lhs;
+	Rhs rhs;
+
+	constexpr operator uint239_t() const;
+};
+
+template <class Operand>
+struct uint239_shift_expr {
+	Operand operand;
+	std::uint64_t shift;
+
+	constexpr operator uint239_t() const;
+};
+
+template <class T>
+inline constexpr bool _isExprNode = false;
+
+template <>
+inline constexpr bool _isExprNode<uint239_leaf> = true;
+
+template <class Op, class Lhs, class Rhs>
+inline constexpr bool _isExprNode<uint239_expr<Op, Lhs, Rhs>> = true;
+
+template <class Operand>
+inline constexpr bool _isExprNode<uint239_shift_expr<Operand>> = true;
+
+template <class T>
+inline constexpr bool _isExprOperand = std::is_same_v<T, uint239_t> || _isExprNode<T>;
+
+constexpr uint239_leaf _exprNode(const uint239_t& value) {
+	return {value};
+}
+
+template <class Node>
+constexpr Node _exprNode(const Node& node) {
+	return node;
+}
+
+template <class T>
+using _exprNodeType = decltype(_exprNode(std::declval<const T&>()));
+
+// The evaluator folds a tree of +, - and * into a signed sum of products, accumulated
+// into one set of limbs modulo 2^256 and masked once by the final encode. Everything is
+// resolved by overloading at compile time: a*b + c instantiates into a single fused
+// multiply-add, a*b - c*d into two multiply-accumulates with one factor negated, and a
+// shift node only moves the shift counter. Shifts follow the uint239_t rules: a term
+// entering with a minus contributes minus its shift.
+template <bool Negate>
+constexpr void _exprAccumulate(const uint239_leaf& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift);
+
+template <bool Negate, class Lhs, class Rhs>
+constexpr void _exprAccumulate(const uint239_expr<uint239_add_op, Lhs, Rhs>& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift);
+
+template <bool Negate, class Lhs, class Rhs>
+constexpr void _exprAccumulate(const uint239_expr<uint239_sub_op, Lhs, Rhs>& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift);
+
+template <bool Negate, class Lhs, class Rhs>
+constexpr void _exprAccumulate(const uint239_expr<uint239_mul_op, Lhs, Rhs>& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift);
+
+template <bool Negate, class Operand>
+constexpr void _exprAccumulate(const uint239_shift_expr<Operand>& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift);
+
+constexpr void _exprEvaluate(const uint239_leaf& node, std::uint64_t limbs[bigint_impl::kNumLimbs], std::uint64_t& shift) {
+	bigint_impl::_kernelDecode(node.value, limbs, shift);
+}
+
+template <class Node>
+constexpr void _exprEvaluate(const Node& node, std::uint64_t limbs[bigint_impl::kNumLimbs], std::uint64_t& shift) {
+	std::fill_n(limbs, bigint_impl::kNumLimbs, 0ULL);
+	shift = 0;
+	_exprAccumulate<false>(node, limbs, shift);
+}
+
+template <bool Negate>
+constexpr void _exprAccumulate(const uint239_leaf& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift) {
+	std::uint64_t limbs[bigint_impl::kNumLimbs];
+	std::uint64_t leaf_shift = 0;
+	bigint_impl::_kernelDecode(node.value, limbs, leaf_shift);
+	if constexpr (Negate) {
+		bigint_impl::_limbsSub(acc, limbs, acc);
+		shift -= leaf_shift;
+	} else {
+		bigint_impl::_limbsAdd(acc, limbs, acc);
+		shift += leaf_shift;
+	}
+}
+
+template <bool Negate, class Lhs, class Rhs>
+constexpr void _exprAccumulate(const uint239_expr<uint239_add_op, Lhs, Rhs>& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift) {
+	_exprAccumulate<Negate>(node.lhs, acc, shift);
+	_exprAccumulate<Negate>(node.rhs, acc, shift);
+}
+
+template <bool Negate, class Lhs, class Rhs>
+constexpr void _exprAccumulate(const uint239_expr<uint239_sub_op, Lhs, Rhs>& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift) {
+	_exprAccumulate<Negate>(node.lhs, acc, shift);
+	_exprAccumulate<!Negate>(node.rhs, acc, shift);
+}
+
+template <bool Negate, class Lhs, class Rhs>
+constexpr void _exprAccumulate(const uint239_expr<uint239_mul_op, Lhs, Rhs>& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift) {
+	std::uint64_t lhs_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t rhs_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	_exprEvaluate(node.lhs, lhs_limbs, lhs_shift);
+	_exprEvaluate(node.rhs, rhs_limbs, rhs_shift);
+	if constexpr (Negate) {
+		bigint_impl::_limbsNegate(lhs_limbs);
+		shift -= lhs_shift + rhs_shift;
+	} else {
+		shift += lhs_shift + rhs_shift;
+	}
+	bigint_impl::_limbsMulAcc(lhs_limbs, rhs_limbs, acc);
+}
+
+template <bool Negate, class Operand>
+constexpr void _exprAccumulate(const uint239_shift_expr<Operand>& node, std::uint64_t acc[bigint_impl::kNumLimbs], std::uint64_t& shift) {
+	_exprAccumulate<Negate>(node.operand, acc, shift);
+	if constexpr (Negate) {
+		shift -= node.shift;
+	} else {
+		shift += node.shift;
+	}
+}
+
+template <class Node>
+constexpr uint239_t _exprMaterialise(const Node& node) {
+	std::uint64_t limbs[bigint_impl::kNumLimbs] = {0};
+	std::uint64_t shift = 0;
+	_exprAccumulate<false>(node, limbs, shift);
+	uint239_t result{};
+	bigint_impl::_kernelEncode(result, limbs, shift);
+	return result;
+}
+
+template <class Op, class Lhs, class Rhs>
+constexpr uint239_expr<Op, Lhs, Rhs>::operator uint239_t() const {
+	return _exprMaterialise(*this);
+}
+
+template <class Operand>
+constexpr uint239_shift_expr<Operand>::operator uint239_t() const {
+	return _exprMaterialise(*this);
+}
+
+// The entry point into a formula. The node keeps a copy of value.
+constexpr uint239_leaf Expr(const uint239_t& value) {
+	return {value};
+}
+
+// At least one side must already be a node, so a + b on two uint239_t keeps the eager
+// operator of number.h.
+template <class Lhs, class Rhs>
+inline constexpr bool _isExprPair = _isExprOperand<Lhs> && _isExprOperand<Rhs> && (_isExprNode<Lhs> || _isExprNode<Rhs>);
+
+template <class Lhs, class Rhs>
+    requires _isExprPair<Lhs, Rhs>
+constexpr uint239_expr<uint239_add_op, _exprNodeType<Lhs>, _exprNodeType<Rhs>> operator+(const Lhs& lhs, const Rhs& rhs) {
+	return {_exprNode(lhs), _exprNode(rhs)};
+}
+
+template <class Lhs, class Rhs>
+    requires _isExprPair<Lhs, Rhs>
+constexpr uint239_expr<uint239_sub_op, _exprNodeType<Lhs>, _exprNodeType<Rhs>> operator-(const Lhs& lhs, const Rhs& rhs) {
+	return {_exprNode(lhs), _exprNode(rhs)};
+}
+
+template <class Lhs, class Rhs>
+    requires _isExprPair<Lhs, Rhs>
+constexpr uint239_expr<uint239_mul_op, _exprNodeType<Lhs>, _exprNodeType<Rhs>> operator*(const Lhs& lhs, const Rhs& rhs) {
+	return {_exprNode(lhs), _exprNode(rhs)};
+}
+
+template <class Operand>
+    requires _isExprNode<Operand>
+constexpr uint239_shift_expr<_exprNodeType<Operand>> operator<<(const Operand& operand, uint32_t shift) {
+	return {_exprNode(operand), static_cast<std::uint64_t>(shift) & bigint_impl::kShiftMask35};
+}
+
+template <class Operand>
+    requires _isExprNode<Operand>
+constexpr uint239_shift_expr<_exprNodeType<Operand>> operator>>(const Operand& operand, uint32_t shift) {
+	return {_exprNode(operand), (0 - static_cast<std::uint64_t>(shift)) & bigint_impl::kShiftMask35};
+}
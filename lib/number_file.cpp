@@ -0,0 +1,391 @@
+#include "number_file.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(BIGINT_X86_TIERS)
+#include <nmmintrin.h>
+#endif
+
+namespace {
+
+constexpr char kFileMagic[8] = {'U', '2', '3', '9', 'C', 'O', 'L', '\0'};
+constexpr std::size_t kValueBytes = sizeof(uint239_t);
+
+// Slicing-by-8 tables for the reflected Castagnoli polynomial.
+constexpr std::array<std::array<std::uint32_t, 256>, 8> _crc32cTables() {
+	std::array<std::array<std::uint32_t, 256>, 8> tables{};
+	for (std::uint32_t byte = 0; byte < 256; ++byte) {
+		std::uint32_t crc = byte;
+		for (int bit = 0; bit < 8; ++bit) {
+			crc = (crc >> 1) ^ (0x82F63B78U & (0U - (crc & 1U)));
+		}
+		tables[0][byte] = crc;
+	}
+	for (int table = 1; table < 8; ++table) {
+		for (std::uint32_t byte = 0; byte < 256; ++byte) {
+			std::uint32_t previous = tables[table - 1][byte];
+			tables[table][byte] = (previous >> 8) ^ tables[0][previous & 0xFF];
+		}
+	}
+	return tables;
+}
+
+constexpr std::array<std::array<std::uint32_t, 256>, 8> kCrc32cTables = _crc32cTables();
+
+std::uint32_t _crc32cGeneric(const std::uint8_t* data, std::size_t size, std::uint32_t crc) {
+	while (size >= 8) {
+		std::uint32_t low = crc ^ (static_cast<std::uint32_t>(data[0]) | static_cast<std::uint32_t>(data[1]) << 8 |
+		                           static_cast<std::uint32_t>(data[2]) << 16 | static_cast<std::uint32_t>(data[3]) << 24);
+		crc = kCrc32cTables[7][low & 0xFF] ^ kCrc32cTables[6][(low >> 8) & 0xFF] ^
+		      kCrc32cTables[5][(low >> 16) & 0xFF] ^ kCrc32cTables[4][low >> 24] ^
+		      kCrc32cTables[3][data[4]] ^ kCrc32cTables[2][data[5]] ^ kCrc32cTables[1][data[6]] ^ kCrc32cTables[0][data[7]];
+		data += 8;
+		size -= 8;
+	}
+	for (; size > 0; --size, ++data) {
+		crc = (crc >> 8) ^ kCrc32cTables[0][(crc ^ *data) & 0xFF];
+	}
+	return crc;
+}
+
+#if defined(BIGINT_X86_TIERS)
+__attribute__((target("sse4.2"))) std::uint32_t _crc32cHardware(const std::uint8_t* data, std::size_t size, std::uint32_t crc) {
+	std::uint64_t wide = crc;
+	for (; size >= 8; size -= 8, data += 8) {
+		std::uint64_t word = 0;
+		std::memcpy(&word, data, 8);
+		wide = _mm_crc32_u64(wide, word);
+	}
+	crc = static_cast<std::uint32_t>(wide);
+	for (; size > 0; --size, ++data) {
+		crc = _mm_crc32_u8(crc, *data);
+	}
+	return crc;
+}
+#endif
+
+}  // namespace
+
+std::uint32_t Crc32c(const void* data, std::size_t size, std::uint32_t crc) {
+	const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+#if defined(BIGINT_X86_TIERS)
+	// Every tier above generic implies SSE4.2; following the tier keeps BIGINT_CPU_TIER=generic portable.
+	static const bool hardware = std::strcmp(GetKernelTier(), "generic") != 0 && __builtin_cpu_supports("sse4.2");
+	if (hardware) {
+		return ~_crc32cHardware(bytes, size, ~crc);
+	}
+#endif
+	return ~_crc32cGeneric(bytes, size, ~crc);
+}
+
+namespace {
+
+bool _storeLe(std::uint8_t* out, std::uint64_t value, int bytes) {
+	for (int i = 0; i < bytes; ++i) {
+		out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+	}
+	return 0;
+}
+
+std::uint64_t _loadLe(const std::uint8_t* in, int bytes) {
+	std::uint64_t value = 0;
+	for (int i = 0; i < bytes; ++i) {
+		value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+	}
+	return value;
+}
+
+[[noreturn]] void _throwFileError(const std::string& path, const std::string& what) {
+	throw std::runtime_error("uint239_t file " + path + ": " + what);
+}
+
+[[noreturn]] void _throwSystemError(const std::string& path, const char* call) {
+	_throwFileError(path, std::string(call) + " failed: " + std::strerror(errno));
+}
+
+bool _writeAll(int fd, const void* data, std::size_t size, const std::string& path) {
+	const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+	while (size > 0) {
+		ssize_t written = ::write(fd, bytes, size);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			_throwSystemError(path, "write");
+		}
+		bytes += written;
+		size -= static_cast<std::size_t>(written);
+	}
+	return 0;
+}
+
+}  // namespace
+
+uint239_file_writer::uint239_file_writer(const std::string& file_path, std::size_t values_per_block)
+	: path(file_path), block_values(values_per_block) {
+	if (block_values == 0) {
+		throw std::invalid_argument("uint239_t file block size must be positive");
+	}
+	fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0) {
+		_throwSystemError(path, "open");
+	}
+	// The header is written last, once the counts and the index are known.
+	std::uint8_t header[kFileHeaderSize] = {};
+	try {
+		_writeAll(fd, header, sizeof(header), path);
+	} catch (...) {
+		::close(fd);
+		fd = -1;
+		throw;
+	}
+	pending.reserve(block_values);
+}
+
+uint239_file_writer::~uint239_file_writer() {
+	try {
+		Close();
+	} catch (...) {
+	}
+}
+
+namespace {
+
+bool _writeBlock(uint239_file_writer& writer, const uint239_t* values, std::size_t count) {
+	std::size_t bytes = count * kValueBytes;
+	uint239_file_block block;
+	block.offset = kFileHeaderSize + writer.value_count * kValueBytes;
+	block.count = count;
+	block.crc = Crc32c(values, bytes);
+	_writeAll(writer.fd, values, bytes, writer.path);
+	writer.blocks.push_back(block);
+	writer.value_count += count;
+	return 0;
+}
+
+}  // namespace
+
+void uint239_file_writer::Append(const uint239_t& value) {
+	if (fd < 0) {
+		_throwFileError(path, "append after Close()");
+	}
+	pending.push_back(value);
+	if (pending.size() == block_values) {
+		_writeBlock(*this, pending.data(), pending.size());
+		pending.clear();
+	}
+}
+
+void uint239_file_writer::Append(std::span<const uint239_t> values) {
+	if (fd < 0) {
+		_throwFileError(path, "append after Close()");
+	}
+	// Top up the pending block, then write whole blocks straight from the caller's memory.
+	while (!pending.empty() && !values.empty()) {
+		Append(values.front());
+		values = values.subspan(1);
+	}
+	while (values.size() >= block_values) {
+		_writeBlock(*this, values.data(), block_values);
+		values = values.subspan(block_values);
+	}
+	pending.insert(pending.end(), values.begin(), values.end());
+}
+
+void uint239_file_writer::Close() {
+	if (fd < 0) {
+		return;
+	}
+	try {
+		if (!pending.empty()) {
+			_writeBlock(*this, pending.data(), pending.size());
+			pending.clear();
+		}
+		std::vector<std::uint8_t> index(blocks.size() * kFileIndexEntrySize);
+		for (std::size_t i = 0; i < blocks.size(); ++i) {
+			std::uint8_t* entry = index.data() + i * kFileIndexEntrySize;
+			_storeLe(entry, blocks[i].offset, 8);
+			_storeLe(entry + 8, blocks[i].count, 8);
+			_storeLe(entry + 16, blocks[i].crc, 4);
+		}
+		_writeAll(fd, index.data(), index.size(), path);
+
+		std::uint8_t header[kFileHeaderSize] = {};
+		std::memcpy(header, kFileMagic, sizeof(kFileMagic));
+		_storeLe(header + 8, kFileVersion, 4);
+		_storeLe(header + 12, kFileHeaderSize, 4);
+		_storeLe(header + 16, value_count, 8);
+		_storeLe(header + 24, block_values, 8);
+		_storeLe(header + 32, blocks.size(), 8);
+		_storeLe(header + 40, kFileHeaderSize + value_count * kValueBytes, 8);
+		_storeLe(header + 48, Crc32c(index.data(), index.size()), 4);
+		_storeLe(header + 52, Crc32c(header, sizeof(header)), 4);
+		if (::pwrite(fd, header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+			_throwSystemError(path, "pwrite");
+		}
+	} catch (...) {
+		::close(fd);
+		fd = -1;
+		throw;
+	}
+	int file = fd;
+	fd = -1;
+	if (::close(file) != 0) {
+		_throwSystemError(path, "close");
+	}
+}
+
+namespace {
+
+bool _advise(const std::uint8_t* mapping, std::size_t begin, std::size_t end, int advice) {
+	static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+	begin -= begin % page;
+	if (end > begin) {
+		::madvise(const_cast<std::uint8_t*>(mapping) + begin, end - begin, advice);
+	}
+	return 0;
+}
+
+// Checks the header and the index and fills in the reader; throws on anything malformed.
+bool _readLayout(uint239_file_reader& reader, const std::string& path) {
+	const std::uint8_t* header = reader.mapping;
+	if (reader.mapping_size < kFileHeaderSize || std::memcmp(header, kFileMagic, sizeof(kFileMagic)) != 0) {
+		_throwFileError(path, "not a uint239_t column file");
+	}
+	std::uint64_t version = _loadLe(header + 8, 4);
+	if (version != kFileVersion) {
+		_throwFileError(path, "unsupported version " + std::to_string(version));
+	}
+	std::uint8_t zeroed[kFileHeaderSize];
+	std::memcpy(zeroed, header, kFileHeaderSize);
+	std::memset(zeroed + 52, 0, 4);
+	if (_loadLe(header + 12, 4) != kFileHeaderSize || _loadLe(header + 52, 4) != Crc32c(zeroed, kFileHeaderSize)) {
+		_throwFileError(path, "header checksum mismatch");
+	}
+
+	std::uint64_t value_count = _loadLe(header + 16, 8);
+	std::uint64_t block_values = _loadLe(header + 24, 8);
+	std::uint64_t block_count = _loadLe(header + 32, 8);
+	std::uint64_t index_offset = _loadLe(header + 40, 8);
+	std::uint64_t max_values = (reader.mapping_size - kFileHeaderSize) / kValueBytes;
+	if (block_values == 0 || value_count > max_values || block_count != (value_count + block_values - 1) / block_values ||
+	    index_offset != kFileHeaderSize + value_count * kValueBytes ||
+	    block_count > (reader.mapping_size - index_offset) / kFileIndexEntrySize) {
+		_throwFileError(path, "inconsistent header");
+	}
+	const std::uint8_t* index = reader.mapping + index_offset;
+	if (_loadLe(header + 48, 4) != Crc32c(index, block_count * kFileIndexEntrySize)) {
+		_throwFileError(path, "index checksum mismatch");
+	}
+
+	reader.value_count = value_count;
+	reader.block_values = block_values;
+	reader.blocks.resize(block_count);
+	for (std::uint64_t i = 0; i < block_count; ++i) {
+		const std::uint8_t* entry = index + i * kFileIndexEntrySize;
+		uint239_file_block& block = reader.blocks[i];
+		block.offset = _loadLe(entry, 8);
+		block.count = _loadLe(entry + 8, 8);
+		block.crc = static_cast<std::uint32_t>(_loadLe(entry + 16, 4));
+		if (block.offset != kFileHeaderSize + i * block_values * kValueBytes ||
+		    block.count != std::min(block_values, value_count - i * block_values)) {
+			_throwFileError(path, "inconsistent index entry " + std::to_string(i));
+		}
+	}
+	return 0;
+}
+
+}  // namespace
+
+uint239_file_reader::uint239_file_reader(const std::string& file_path, uint239_file_access access) {
+	fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		_throwSystemError(file_path, "open");
+	}
+	try {
+		struct stat info{};
+		if (::fstat(fd, &info) != 0) {
+			_throwSystemError(file_path, "fstat");
+		}
+		mapping_size = static_cast<std::size_t>(info.st_size);
+		if (mapping_size < kFileHeaderSize) {
+			_throwFileError(file_path, "not a uint239_t column file");
+		}
+		void* address = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+		if (address == MAP_FAILED) {
+			_throwSystemError(file_path, "mmap");
+		}
+		mapping = static_cast<const std::uint8_t*>(address);
+		if (access != uint239_file_access::normal) {
+			_advise(mapping, 0, mapping_size, access == uint239_file_access::random ? MADV_RANDOM : MADV_SEQUENTIAL);
+		}
+		_readLayout(*this, file_path);
+	} catch (...) {
+		if (mapping != nullptr) {
+			::munmap(const_cast<std::uint8_t*>(mapping), mapping_size);
+		}
+		::close(fd);
+		throw;
+	}
+}
+
+uint239_file_reader::~uint239_file_reader() {
+	::munmap(const_cast<std::uint8_t*>(mapping), mapping_size);
+	::close(fd);
+}
+
+std::size_t uint239_file_reader::Size() const {
+	return value_count;
+}
+
+std::size_t uint239_file_reader::BlockCount() const {
+	return blocks.size();
+}
+
+std::span<const uint239_t> uint239_file_reader::Values() const {
+	return {reinterpret_cast<const uint239_t*>(mapping + kFileHeaderSize), value_count};
+}
+
+bool uint239_file_reader::VerifyBlock(std::size_t block) const {
+	if (block >= blocks.size()) {
+		throw std::out_of_range("uint239_t file block out of range");
+	}
+	const uint239_file_block& entry = blocks[block];
+	return Crc32c(mapping + entry.offset, entry.count * kValueBytes) == entry.crc;
+}
+
+std::span<const uint239_t> uint239_file_reader::Block(std::size_t block) const {
+	if (!VerifyBlock(block)) {
+		throw std::runtime_error("uint239_t file: checksum mismatch in block " + std::to_string(block));
+	}
+	const uint239_file_block& entry = blocks[block];
+	return {reinterpret_cast<const uint239_t*>(mapping + entry.offset), entry.count};
+}
+
+void uint239_file_reader::Scan(const std::function<void(std::span<const uint239_t>)>& fn, std::size_t prefetch_blocks) const {
+	std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+	auto block_end = [&](std::size_t block) { return blocks[block].offset + blocks[block].count * kValueBytes; };
+	for (std::size_t block = 0; block < std::min(prefetch_blocks, blocks.size()); ++block) {
+		_advise(mapping, blocks[block].offset, block_end(block), MADV_WILLNEED);
+	}
+	for (std::size_t block = 0; block < blocks.size(); ++block) {
+		if (prefetch_blocks > 0 && block + prefetch_blocks < blocks.size()) {
+			std::size_t ahead = block + prefetch_blocks;
+			_advise(mapping, blocks[ahead].offset, block_end(ahead), MADV_WILLNEED);
+		}
+		fn(Block(block));
+		// The page holding the end of this block also holds the start of the next one.
+		std::size_t end = block_end(block);
+		_advise(mapping, blocks[block].offset, end - end % page, MADV_DONTNEED);
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+// Columnar files of uint239_t values (POSIX only: the reader maps the file with mmap).
+//
+// Layout, all integers little-endian:
+//   header     64 bytes: magic "U239COL\0", version, header size, value count, values per
+//              block, block count, index offset, CRC32C of the index, CRC32C of the header
+//              (taken with its own field zeroed) and 8 reserved bytes.
+//   values     every value's 35 I-Endian bytes back to back, shift bits included, so the
+//              mapped file is itself an array of uint239_t.
+//   index      one 24-byte entry per block: byte offset, value count and CRC32C of the block.
+// Every block but the last holds the same number of values. A reader rejects any other
+// version, so the layout can change by bumping kFileVersion.
+#include "number.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+inline constexpr std::uint32_t kFileVersion = 1;
+inline constexpr std::size_t kFileHeaderSize = 64;
+inline constexpr std::size_t kFileIndexEntrySize = 24;
+inline constexpr std::size_t kFileBlockValues = 65536;
+
+struct uint239_file_block {
+	std::uint64_t offset = 0;
+	std::uint64_t count = 0;
+	std::uint32_t crc = 0;
+};
+
+// CRC32C (Castagnoli), the checksum of the header, the index and every block. Runs on the
+// SSE4.2 crc32 instruction unless the kernel tier (see GetKernelTier) is generic.
+std::uint32_t Crc32c(const void* data, std::size_t size, std::uint32_t crc = 0);
+
+// Writes values as they are appended and the index and header on Close(). Errors throw
+// std::runtime_error with the path and the system error; the destructor closes a file
+// that was not closed and swallows the error, so call Close() to see it.
+struct uint239_file_writer {
+	int fd = -1;
+	std::string path;
+	std::size_t block_values = 0;
+	std::uint64_t value_count = 0;
+	std::vector<uint239_file_block> blocks;
+	std::vector<uint239_t> pending;
+
+	// Throws std::invalid_argument for zero block_values.
+	explicit uint239_file_writer(const std::string& file_path, std::size_t values_per_block = kFileBlockValues);
+
+	uint239_file_writer(const uint239_file_writer&) = delete;
+	uint239_file_writer& operator=(const uint239_file_writer&) = delete;
+
+	~uint239_file_writer();
+
+	void Append(const uint239_t& value);
+
+	void Append(std::span<const uint239_t> values);
+
+	void Close();
+};
+
+// How a reader expects to touch the file, passed on to the kernel with madvise: normal
+// leaves its defaults, random turns read-ahead off for point lookups and sequential
+// reads ahead aggressively for scans.
+enum class uint239_file_access : uint8_t {
+	normal,
+	random,
+	sequential,
+};
+
+// Maps a file written by uint239_file_writer and hands out views into the mapping; no
+// value is copied. Opening checks the header and the index; block checksums are checked
+// by Block(), VerifyBlock() and Scan(), since checking them all up front would read the
+// whole file. Malformed files and failed checksums throw std::runtime_error.
+struct uint239_file_reader {
+	int fd = -1;
+	const std::uint8_t* mapping = nullptr;
+	std::size_t mapping_size = 0;
+	std::size_t block_values = 0;
+	std::uint64_t value_count = 0;
+	std::vector<uint239_file_block> blocks;
+
+	explicit uint239_file_reader(const std::string& file_path, uint239_file_access access = uint239_file_access::normal);
+
+	uint239_file_reader(const uint239_file_reader&) = delete;
+	uint239_file_reader& operator=(const uint239_file_reader&) = delete;
+
+	~uint239_file_reader();
+
+	std::size_t Size() const;
+
+	std::size_t BlockCount() const;
+
+	// The whole column, without checksum checks.
+	std::span<const uint239_t> Values() const;
+
+	// One block after checking its checksum. Throws std::out_of_range past the last block.
+	std::span<const uint239_t> Block(std::size_t block) const;
+
+	bool VerifyBlock(std::size_t block) const;
+
+	// Calls fn on every block in order, checked like Block(). Blocks ahead of the scan are
+	// prefetched with madvise(MADV_WILLNEED) and the pages of finished blocks released
+	// with MADV_DONTNEED, so a scan of a file larger than memory streams through it.
+	void Scan(const std::function<void(std::span<const uint239_t>)>& fn, std::size_t prefetch_blocks = 4) const;
+};
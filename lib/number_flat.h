@@ -0,0 +1,292 @@
+#pragma once
+// Open-addressing hash tables keyed by uint239_t value. Keys are stored canonically,
+// re-encoded with zero shift, and every slot keeps the key hash next to a one-byte tag
+// taken from it. A lookup canonicalises its key once; after that a probe compares tags and
+// raw key bytes and never decodes a stored key, and growing moves slots by their stored
+// hash. Linear probing over a power-of-two table that grows past 7/8 load; Erase leaves
+// a tombstone, which inserts reuse and rehashing drops.
+#include "number.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// A key as a probe needs it: the canonical bytes and the full hash.
+struct uint239_flat_key {
+	uint239_t canonical;
+	std::uint64_t hash = 0;
+};
+
+inline uint239_flat_key _flatKey(const uint239_t& key) {
+	std::uint64_t limbs[bigint_impl::kNumLimbs];
+	std::uint64_t shift = 0;
+	bigint_impl::_kernelDecode(key, limbs, shift);
+	uint239_flat_key result;
+	bigint_impl::_kernelEncode(result.canonical, limbs, 0);
+	result.hash = bigint_impl::_hashLimbs(limbs);
+	return result;
+}
+
+inline const uint239_t& _flatSlotKey(const uint239_t& slot) {
+	return slot;
+}
+
+template <class Value>
+const uint239_t& _flatSlotKey(const std::pair<uint239_t, Value>& slot) {
+	return slot.first;
+}
+
+inline constexpr std::uint8_t kFlatEmpty = 0;
+inline constexpr std::uint8_t kFlatTombstone = 1;
+inline constexpr std::size_t kFlatMinCapacity = 16;
+inline constexpr std::size_t kFlatMissing = ~static_cast<std::size_t>(0);
+
+// Tags of live slots have the top bit set and carry seven more bits of the hash.
+constexpr std::uint8_t _flatTag(std::uint64_t hash) {
+	return static_cast<std::uint8_t>(0x80 | (hash >> 57));
+}
+
+// The table behind both containers; Slot is uint239_t or std::pair<uint239_t, Value>.
+template <class Slot>
+struct _flatTable {
+	std::vector<std::uint8_t> tags;
+	std::vector<std::uint64_t> hashes;
+	std::vector<Slot> slots;
+	std::size_t count = 0;
+	std::size_t occupied = 0; // live slots plus tombstones
+
+	// Index of the slot holding key, or kFlatMissing. insert_at is set to the first free
+	// slot on the probe path, kFlatMissing for a table without slots.
+	std::size_t Probe(const uint239_flat_key& key, std::size_t& insert_at) const {
+		insert_at = kFlatMissing;
+		if (tags.empty()) {
+			return kFlatMissing;
+		}
+		std::size_t mask = tags.size() - 1;
+		std::uint8_t tag = _flatTag(key.hash);
+		for (std::size_t index = key.hash & mask;; index = (index + 1) & mask) {
+			std::uint8_t slot_tag = tags[index];
+			if (slot_tag == kFlatEmpty) {
+				if (insert_at == kFlatMissing) {
+					insert_at = index;
+				}
+				return kFlatMissing;
+			}
+			if (slot_tag == kFlatTombstone) {
+				if (insert_at == kFlatMissing) {
+					insert_at = index;
+				}
+			} else if (slot_tag == tag && std::memcmp(_flatSlotKey(slots[index]).data, key.canonical.data, sizeof(key.canonical.data)) == 0) {
+				return index;
+			}
+		}
+	}
+
+	void Rehash(std::size_t capacity) {
+		std::vector<std::uint8_t> old_tags = std::exchange(tags, std::vector<std::uint8_t>(capacity, kFlatEmpty));
+		std::vector<std::uint64_t> old_hashes = std::exchange(hashes, std::vector<std::uint64_t>(capacity));
+		std::vector<Slot> old_slots = std::exchange(slots, std::vector<Slot>(capacity));
+		occupied = count;
+		std::size_t mask = capacity - 1;
+		for (std::size_t i = 0; i < old_tags.size(); ++i) {
+			if (old_tags[i] < 0x80) {
+				continue;
+			}
+			std::uint64_t hash = old_hashes[i];
+			std::size_t index = hash & mask;
+			while (tags[index] != kFlatEmpty) {
+				index = (index + 1) & mask;
+			}
+			tags[index] = old_tags[i];
+			hashes[index] = hash;
+			slots[index] = std::move(old_slots[i]);
+		}
+	}
+
+	void Reserve(std::size_t live) {
+		std::size_t capacity = std::bit_ceil(std::max(kFlatMinCapacity, live + live / 7 + 1));
+		if (capacity > tags.size()) {
+			Rehash(capacity);
+		}
+	}
+
+	// Finds key or claims a slot for it; the caller fills a claimed slot.
+	std::size_t Claim(const uint239_flat_key& key, bool& inserted) {
+		std::size_t insert_at = kFlatMissing;
+		std::size_t index = Probe(key, insert_at);
+		inserted = index == kFlatMissing;
+		if (!inserted) {
+			return index;
+		}
+		if ((occupied + 1) * 8 > tags.size() * 7) {
+			Rehash(std::bit_ceil(std::max(kFlatMinCapacity, (count + 1) * 2)));
+			Probe(key, insert_at);
+		}
+		if (tags[insert_at] == kFlatEmpty) {
+			++occupied;
+		}
+		tags[insert_at] = _flatTag(key.hash);
+		hashes[insert_at] = key.hash;
+		++count;
+		return insert_at;
+	}
+
+	void EraseAt(std::size_t index) {
+		tags[index] = kFlatTombstone;
+		slots[index] = Slot();
+		--count;
+	}
+
+	void Clear() {
+		tags.clear();
+		hashes.clear();
+		slots.clear();
+		count = 0;
+		occupied = 0;
+	}
+};
+
+struct uint239_flat_set {
+	_flatTable<uint239_t> table;
+
+	std::size_t Size() const {
+		return table.count;
+	}
+
+	bool Empty() const {
+		return table.count == 0;
+	}
+
+	void Clear() {
+		table.Clear();
+	}
+
+	// Makes room for count keys without growing again.
+	void Reserve(std::size_t count) {
+		table.Reserve(count);
+	}
+
+	// Returns true when the key was not there yet.
+	bool Insert(const uint239_t& key) {
+		uint239_flat_key flat = _flatKey(key);
+		bool inserted = false;
+		std::size_t index = table.Claim(flat, inserted);
+		if (inserted) {
+			table.slots[index] = flat.canonical;
+		}
+		return inserted;
+	}
+
+	bool Contains(const uint239_t& key) const {
+		std::size_t insert_at = 0;
+		return table.Probe(_flatKey(key), insert_at) != kFlatMissing;
+	}
+
+	bool Erase(const uint239_t& key) {
+		std::size_t insert_at = 0;
+		std::size_t index = table.Probe(_flatKey(key), insert_at);
+		if (index == kFlatMissing) {
+			return false;
+		}
+		table.EraseAt(index);
+		return true;
+	}
+
+	// Calls fn(key) for every key, in table order, with the key in its zero-shift form.
+	template <class Fn>
+	void ForEach(Fn fn) const {
+		for (std::size_t i = 0; i < table.tags.size(); ++i) {
+			if (table.tags[i] >= 0x80) {
+				fn(table.slots[i]);
+			}
+		}
+	}
+};
+
+// Value must be default-constructible and movable.
+template <class Value>
+struct uint239_flat_map {
+	_flatTable<std::pair<uint239_t, Value>> table;
+
+	std::size_t Size() const {
+		return table.count;
+	}
+
+	bool Empty() const {
+		return table.count == 0;
+	}
+
+	void Clear() {
+		table.Clear();
+	}
+
+	void Reserve(std::size_t count) {
+		table.Reserve(count);
+	}
+
+	// Stores value under key unless the key is there already; returns the stored value
+	// and whether it was inserted, like std::unordered_map::emplace.
+	std::pair<Value*, bool> Insert(const uint239_t& key, Value value) {
+		uint239_flat_key flat = _flatKey(key);
+		bool inserted = false;
+		std::size_t index = table.Claim(flat, inserted);
+		if (inserted) {
+			table.slots[index] = {flat.canonical, std::move(value)};
+		}
+		return {&table.slots[index].second, inserted};
+	}
+
+	Value& operator[](const uint239_t& key) {
+		return *Insert(key, Value()).first;
+	}
+
+	// nullptr when the key is missing. The pointer stays valid until the next insert.
+	Value* Find(const uint239_t& key) {
+		std::size_t insert_at = 0;
+		std::size_t index = table.Probe(_flatKey(key), insert_at);
+		return index == kFlatMissing ? nullptr : &table.slots[index].second;
+	}
+
+	const Value* Find(const uint239_t& key) const {
+		std::size_t insert_at = 0;
+		std::size_t index = table.Probe(_flatKey(key), insert_at);
+		return index == kFlatMissing ? nullptr : &table.slots[index].second;
+	}
+
+	bool Contains(const uint239_t& key) const {
+		return Find(key) != nullptr;
+	}
+
+	bool Erase(const uint239_t& key) {
+		std::size_t insert_at = 0;
+		std::size_t index = table.Probe(_flatKey(key), insert_at);
+		if (index == kFlatMissing) {
+			return false;
+		}
+		table.EraseAt(index);
+		return true;
+	}
+
+	// Calls fn(key, value) for every entry, in table order, with the key in its zero-shift form.
+	template <class Fn>
+	void ForEach(Fn fn) const {
+		for (std::size_t i = 0; i < table.tags.size(); ++i) {
+			if (table.tags[i] >= 0x80) {
+				fn(table.slots[i].first, table.slots[i].second);
+			}
+		}
+	}
+
+	template <class Fn>
+	void ForEach(Fn fn) {
+		for (std::size_t i = 0; i < table.tags.size(); ++i) {
+			if (table.tags[i] >= 0x80) {
+				fn(table.slots[i].first, table.slots[i].second);
+			}
+		}
+	}
+};
@@ -0,0 +1,2063 @@
+#pragma once
+// Included at the end of number.h: the codec and the limb engine are constexpr,
+// so their definitions have to be visible wherever the public functions are used.
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__BMI2__) || defined(BIGINT_KERNEL_BMI2)
+#include <immintrin.h>
+#endif
+
+#if defined(BIGINT_INSTRUMENTATION)
+// Defined in number_stats.cpp. _statsEnter counts a call and returns true when this call
+// is one to time, having read the clock into start.
+bool _statsEnter(uint239_op op, std::uint64_t& start);
+
+void _statsLeave(uint239_op op, std::uint64_t start);
+
+// Counts the enclosing call at run time; constant evaluation never reaches the counters.
+struct _statsScope {
+	uint239_op op;
+	std::uint64_t start = 0;
+	bool sampled = false;
+
+	constexpr explicit _statsScope(uint239_op counted) : op(counted) {
+		if (!std::is_constant_evaluated()) {
+			sampled = _statsEnter(op, start);
+		}
+	}
+
+	constexpr ~_statsScope() {
+		if (!std::is_constant_evaluated() && sampled) {
+			_statsLeave(op, start);
+		}
+	}
+};
+
+#define BIGINT_STATS_SCOPE(op) _statsScope _stats_scope(uint239_op::op)
+#else
+#define BIGINT_STATS_SCOPE(op) static_cast<void>(0)
+#endif
+
+// The helpers live in bigint_impl. The library compiles them once per CPU tier (see
+// number_kernels.cpp), each time in its own inline namespace, so the inline copies of
+// different tiers never get merged. A tier
+// build names its features in BIGINT_KERNEL_TARGET, and they become a target attribute of
+// everything between BIGINT_KERNEL_TARGET_BEGIN and _END; code outside, the standard
+// library included, stays generic and may be shared with the rest of the program.
+#if !defined(BIGINT_KERNEL_NAMESPACE)
+#define BIGINT_KERNEL_NAMESPACE bigint_shared
+#endif
+
+#if defined(BIGINT_KERNEL_TARGET)
+#define BIGINT_PRAGMA(text) _Pragma(#text)
+#if defined(__clang__)
+#define BIGINT_TARGET_PUSH(features) BIGINT_PRAGMA(clang attribute push(__attribute__((target(features))), apply_to = function))
+#define BIGINT_KERNEL_TARGET_END BIGINT_PRAGMA(clang attribute pop)
+#else
+#define BIGINT_TARGET_PUSH(features) BIGINT_PRAGMA(GCC push_options) BIGINT_PRAGMA(GCC target(features))
+#define BIGINT_KERNEL_TARGET_END BIGINT_PRAGMA(GCC pop_options)
+#endif
+#define BIGINT_KERNEL_TARGET_BEGIN BIGINT_TARGET_PUSH(BIGINT_KERNEL_TARGET)
+#else
+#define BIGINT_KERNEL_TARGET_BEGIN
+#define BIGINT_KERNEL_TARGET_END
+#endif
+
+BIGINT_KERNEL_TARGET_BEGIN
+namespace bigint_impl {
+inline namespace BIGINT_KERNEL_NAMESPACE {
+
+inline constexpr int kGroupsPerChunk = 8;
+inline constexpr std::uint64_t kGroupMask = 0x7F7F7F7F7F7F7F7FULL;
+inline constexpr std::uint64_t kServiceMask = 0x8080808080808080ULL;
+
+// The I-Endian form of a Bits-bit value: one byte per 7 data bits, whose service bits
+// hold a kBytes-bit shift, and the word counts the kernels below work on. The codec and
+// the limb kernels are templates over the width or the limb count; uint239_t is the
+// width 239 with four limbs, and every other uint_t (number_uint_impl.h) runs on them too.
+template <int Bits>
+struct _uintLayout {
+	static constexpr int kBytes = (Bits + 6) / 7;
+	static constexpr int kDataBits = kBytes * 7;
+	static constexpr int kPaddingBits = kDataBits - Bits;
+	static constexpr int kShiftWords = (kBytes + 63) / 64;
+	static constexpr std::uint64_t kTopShiftWordMask = kBytes % 64 == 0 ? ~0ULL : (1ULL << (kBytes % 64)) - 1ULL;
+	static constexpr int kLimbs = (Bits + 63) / 64;
+	static constexpr std::uint64_t kTopLimbMask = Bits % 64 == 0 ? ~0ULL : (1ULL << (Bits % 64)) - 1ULL;
+	static constexpr int kDataWords = (kDataBits + 63) / 64;
+	static constexpr std::uint64_t kTopDataWordMask = kDataBits % 64 == 0 ? ~0ULL : (1ULL << (kDataBits % 64)) - 1ULL;
+	static constexpr int kFullChunks = kBytes / kGroupsPerChunk;
+	static constexpr int kTailBytes = kBytes % kGroupsPerChunk;
+};
+
+inline constexpr int kSignificantBits = 239;
+inline constexpr int kNumBytes = _uintLayout<kSignificantBits>::kBytes;
+inline constexpr int kDataBits = _uintLayout<kSignificantBits>::kDataBits;
+inline constexpr int kPaddingBits = _uintLayout<kSignificantBits>::kPaddingBits;
+inline constexpr std::uint64_t kShiftMask35 = _uintLayout<kSignificantBits>::kTopShiftWordMask;
+inline constexpr int kNumLimbs = _uintLayout<kSignificantBits>::kLimbs;
+inline constexpr std::uint64_t kTopLimbMask = _uintLayout<kSignificantBits>::kTopLimbMask;
+inline constexpr int kNumDataWords = _uintLayout<kSignificantBits>::kDataWords;
+inline constexpr std::uint64_t kTopDataWordMask = _uintLayout<kSignificantBits>::kTopDataWordMask;
+inline constexpr int kNumFullChunks = _uintLayout<kSignificantBits>::kFullChunks;
+inline constexpr int kTailBytes = _uintLayout<kSignificantBits>::kTailBytes;
+
+inline constexpr int kDecimalChunkDigits = 19;
+inline constexpr std::uint64_t kPowersOf10[kDecimalChunkDigits + 1] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+	10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+	10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL,
+};
+
+static_assert(kNumBytes == 35 && _uintLayout<kSignificantBits>::kShiftWords == 1, "uint239_t keeps a 35-bit shift in one word");
+static_assert(kNumDataWords == kNumLimbs, "Stored data bits must fit into the limb form");
+
+constexpr std::uint64_t _byteSwap64(std::uint64_t word) {
+#if defined(__GNUC__)
+	return __builtin_bswap64(word);
+#else
+	std::uint64_t swapped = 0;
+	for (int i = 0; i < 8; ++i) {
+		swapped = (swapped << 8) | (word & 0xFFULL);
+		word >>= 8;
+	}
+	return swapped;
+#endif
+}
+
+constexpr std::uint64_t _loadReversed(const std::uint8_t* bytes, int count) {
+	std::uint64_t chunk = 0;
+	for (int i = 0; i < count; ++i) {
+		chunk = (chunk << 8) | bytes[i];
+	}
+	return chunk;
+}
+
+constexpr bool _storeReversed(std::uint8_t* bytes, int count, std::uint64_t chunk) {
+	for (int i = count - 1; i >= 0; --i) {
+		bytes[i] = static_cast<std::uint8_t>(chunk);
+		chunk >>= 8;
+	}
+	return 0;
+}
+
+constexpr std::uint64_t _loadReversed64(const std::uint8_t* bytes) {
+	if (std::endian::native == std::endian::little && !std::is_constant_evaluated()) {
+		std::uint64_t chunk = 0;
+		std::memcpy(&chunk, bytes, sizeof(chunk));
+		return _byteSwap64(chunk);
+	}
+	return _loadReversed(bytes, kGroupsPerChunk);
+}
+
+constexpr bool _storeReversed64(std::uint8_t* bytes, std::uint64_t chunk) {
+	if (std::endian::native == std::endian::little && !std::is_constant_evaluated()) {
+		chunk = _byteSwap64(chunk);
+		std::memcpy(bytes, &chunk, sizeof(chunk));
+		return 0;
+	}
+	return _storeReversed(bytes, kGroupsPerChunk, chunk);
+}
+
+// Gathers the low 7 bits of every byte of the chunk into one 56-bit run.
+constexpr std::uint64_t _packGroups(std::uint64_t chunk) {
+#if defined(__BMI2__) || defined(BIGINT_KERNEL_BMI2)
+	if (!std::is_constant_evaluated()) {
+		return _pext_u64(chunk, kGroupMask);
+	}
+#endif
+	chunk &= kGroupMask;
+	chunk = (chunk & 0x007F007F007F007FULL) | ((chunk & 0x7F007F007F007F00ULL) >> 1);
+	chunk = (chunk & 0x00003FFF00003FFFULL) | ((chunk & 0x3FFF00003FFF0000ULL) >> 2);
+	chunk = (chunk & 0x000000000FFFFFFFULL) | ((chunk & 0x0FFFFFFF00000000ULL) >> 4);
+	return chunk;
+}
+
+constexpr std::uint64_t _unpackGroups(std::uint64_t groups) {
+#if defined(__BMI2__) || defined(BIGINT_KERNEL_BMI2)
+	if (!std::is_constant_evaluated()) {
+		return _pdep_u64(groups, kGroupMask);
+	}
+#endif
+	groups &= 0x00FFFFFFFFFFFFFFULL;
+	groups = (groups & 0x000000000FFFFFFFULL) | ((groups << 4) & 0x0FFFFFFF00000000ULL);
+	groups = (groups & 0x00003FFF00003FFFULL) | ((groups << 2) & 0x3FFF00003FFF0000ULL);
+	groups = (groups & 0x007F007F007F007FULL) | ((groups << 1) & 0x7F007F007F007F00ULL);
+	return groups;
+}
+
+// Gathers the service (top) bit of every byte of the chunk into 8 bits.
+constexpr std::uint64_t _packServiceBits(std::uint64_t chunk) {
+#if defined(__BMI2__) || defined(BIGINT_KERNEL_BMI2)
+	if (!std::is_constant_evaluated()) {
+		return _pext_u64(chunk, kServiceMask);
+	}
+#endif
+	chunk = (chunk >> 7) & 0x0101010101010101ULL;
+	chunk = (chunk | (chunk >> 7)) & 0x0003000300030003ULL;
+	chunk = (chunk | (chunk >> 14)) & 0x0000000F0000000FULL;
+	chunk = (chunk | (chunk >> 28)) & 0xFFULL;
+	return chunk;
+}
+
+constexpr std::uint64_t _unpackServiceBits(std::uint64_t bits) {
+#if defined(__BMI2__) || defined(BIGINT_KERNEL_BMI2)
+	if (!std::is_constant_evaluated()) {
+		return _pdep_u64(bits, kServiceMask);
+	}
+#endif
+	bits &= 0xFFULL;
+	bits = (bits | (bits << 28)) & 0x0000000F0000000FULL;
+	bits = (bits | (bits << 14)) & 0x0003000300030003ULL;
+	bits = (bits | (bits << 7)) & 0x0101010101010101ULL;
+	return bits << 7;
+}
+
+template <int W = kNumDataWords>
+constexpr std::uint64_t _wordsBitsAt(const std::uint64_t words[W], int offset) {
+	int word_index = offset / 64;
+	int bit_index = offset % 64;
+	std::uint64_t bits = words[word_index] >> bit_index;
+	if (bit_index != 0 && word_index + 1 < W) {
+		bits |= words[word_index + 1] << (64 - bit_index);
+	}
+	return bits;
+}
+
+template <int W = kNumDataWords>
+constexpr bool _wordsOrBitsAt(std::uint64_t words[W], int offset, std::uint64_t bits) {
+	int word_index = offset / 64;
+	int bit_index = offset % 64;
+	words[word_index] |= bits << bit_index;
+	if (bit_index != 0 && word_index + 1 < W) {
+		words[word_index + 1] |= bits >> (64 - bit_index);
+	}
+	return 0;
+}
+
+// The shift of a width with more than 64 service bits: little-endian words that wrap
+// modulo 2^(64 Words) until _maskShift cuts them to the width. Widths of up to 64 bytes,
+// uint239_t among them, keep their shift in a plain word.
+template <int Words>
+struct _wideShift {
+	std::uint64_t words[Words] = {};
+
+	constexpr _wideShift() = default;
+
+	constexpr _wideShift(std::uint64_t low) : words{low} {}
+};
+
+template <int Bits>
+using _uintShift = std::conditional_t<_uintLayout<Bits>::kShiftWords == 1, std::uint64_t, _wideShift<_uintLayout<Bits>::kShiftWords>>;
+
+constexpr std::uint64_t _shiftBitsAt(std::uint64_t shift, int offset) {
+	return shift >> offset;
+}
+
+template <int Words>
+constexpr std::uint64_t _shiftBitsAt(const _wideShift<Words>& shift, int offset) {
+	return _wordsBitsAt<Words>(shift.words, offset);
+}
+
+constexpr bool _shiftOrBitsAt(std::uint64_t& shift, int offset, std::uint64_t bits) {
+	shift |= bits << offset;
+	return 0;
+}
+
+template <int Words>
+constexpr bool _shiftOrBitsAt(_wideShift<Words>& shift, int offset, std::uint64_t bits) {
+	return _wordsOrBitsAt<Words>(shift.words, offset, bits);
+}
+
+// The shift modulo the number of stored data bits, which is the rotation it stands for.
+constexpr std::uint64_t _shiftMod(std::uint64_t shift, int modulus) {
+	return shift % static_cast<std::uint64_t>(modulus);
+}
+
+template <int Words>
+constexpr std::uint64_t _shiftMod(const _wideShift<Words>& shift, int modulus) {
+	std::uint64_t divisor = static_cast<std::uint64_t>(modulus);
+	std::uint64_t remainder = 0;
+	for (int i = Words - 1; i >= 0; --i) {
+		remainder = ((remainder << 32) | (shift.words[i] >> 32)) % divisor;
+		remainder = ((remainder << 32) | (shift.words[i] & 0xFFFFFFFFULL)) % divisor;
+	}
+	return remainder;
+}
+
+constexpr std::uint64_t _shiftLow64(std::uint64_t shift) {
+	return shift;
+}
+
+template <int Words>
+constexpr std::uint64_t _shiftLow64(const _wideShift<Words>& shift) {
+	return shift.words[0];
+}
+
+template <int Bits>
+constexpr _uintShift<Bits> _maskShift(_uintShift<Bits> shift) {
+	using Layout = _uintLayout<Bits>;
+	if constexpr (Layout::kShiftWords == 1) {
+		return shift & Layout::kTopShiftWordMask;
+	} else {
+		shift.words[Layout::kShiftWords - 1] &= Layout::kTopShiftWordMask;
+		return shift;
+	}
+}
+
+// The kDataBits stored data bits as a little-endian number: the last byte holds bits 0..6.
+// Bytes are processed in word-sized chunks counted from the last byte, plus a short tail.
+template <int Bits>
+constexpr bool _loadStored(const uint_t<Bits>& value, std::uint64_t stored[_uintLayout<Bits>::kDataWords], _uintShift<Bits>& out_shift) {
+	using Layout = _uintLayout<Bits>;
+	std::fill_n(stored, Layout::kDataWords, 0ULL);
+	_uintShift<Bits> shift{};
+	for (int chunk_index = 0; chunk_index < Layout::kFullChunks; ++chunk_index) {
+		int group_index = chunk_index * kGroupsPerChunk;
+		std::uint64_t chunk = _loadReversed64(value.data + Layout::kBytes - group_index - kGroupsPerChunk);
+		_wordsOrBitsAt<Layout::kDataWords>(stored, group_index * 7, _packGroups(chunk));
+		_shiftOrBitsAt(shift, group_index, _packServiceBits(chunk));
+	}
+	if constexpr (Layout::kTailBytes != 0) {
+		int group_index = Layout::kFullChunks * kGroupsPerChunk;
+		std::uint64_t chunk = _loadReversed(value.data, Layout::kTailBytes);
+		_wordsOrBitsAt<Layout::kDataWords>(stored, group_index * 7, _packGroups(chunk));
+		_shiftOrBitsAt(shift, group_index, _packServiceBits(chunk));
+	}
+	out_shift = _maskShift<Bits>(shift);
+	return 0;
+}
+
+template <int Bits>
+constexpr bool _storeStored(uint_t<Bits>& value, const std::uint64_t stored[_uintLayout<Bits>::kDataWords], const _uintShift<Bits>& shift) {
+	using Layout = _uintLayout<Bits>;
+	for (int chunk_index = 0; chunk_index < Layout::kFullChunks; ++chunk_index) {
+		int group_index = chunk_index * kGroupsPerChunk;
+		std::uint64_t chunk = _unpackGroups(_wordsBitsAt<Layout::kDataWords>(stored, group_index * 7)) | _unpackServiceBits(_shiftBitsAt(shift, group_index));
+		_storeReversed64(value.data + Layout::kBytes - group_index - kGroupsPerChunk, chunk);
+	}
+	if constexpr (Layout::kTailBytes != 0) {
+		int group_index = Layout::kFullChunks * kGroupsPerChunk;
+		std::uint64_t chunk = _unpackGroups(_wordsBitsAt<Layout::kDataWords>(stored, group_index * 7)) | _unpackServiceBits(_shiftBitsAt(shift, group_index));
+		_storeReversed(value.data, Layout::kTailBytes, chunk);
+	}
+	return 0;
+}
+
+// The shift alone, without the data bits.
+template <int Bits>
+constexpr _uintShift<Bits> _loadShift(const uint_t<Bits>& value) {
+	using Layout = _uintLayout<Bits>;
+	_uintShift<Bits> shift{};
+	for (int chunk_index = 0; chunk_index < Layout::kFullChunks; ++chunk_index) {
+		int group_index = chunk_index * kGroupsPerChunk;
+		_shiftOrBitsAt(shift, group_index, _packServiceBits(_loadReversed64(value.data + Layout::kBytes - group_index - kGroupsPerChunk)));
+	}
+	if constexpr (Layout::kTailBytes != 0) {
+		_shiftOrBitsAt(shift, Layout::kFullChunks * kGroupsPerChunk, _packServiceBits(_loadReversed(value.data, Layout::kTailBytes)));
+	}
+	return _maskShift<Bits>(shift);
+}
+
+template <int W = kNumDataWords>
+constexpr bool _wordsShiftLeft(const std::uint64_t words[W], int bits, std::uint64_t result[W]) {
+	int word_shift = bits / 64;
+	int bit_shift = bits % 64;
+	for (int i = W - 1; i >= 0; --i) {
+		std::uint64_t word = 0;
+		if (i - word_shift >= 0) {
+			word = words[i - word_shift] << bit_shift;
+			if (bit_shift != 0 && i - word_shift - 1 >= 0) {
+				word |= words[i - word_shift - 1] >> (64 - bit_shift);
+			}
+		}
+		result[i] = word;
+	}
+	return 0;
+}
+
+template <int W = kNumDataWords>
+constexpr bool _wordsShiftRight(const std::uint64_t words[W], int bits, std::uint64_t result[W]) {
+	int word_shift = bits / 64;
+	int bit_shift = bits % 64;
+	for (int i = 0; i < W; ++i) {
+		std::uint64_t word = 0;
+		if (i + word_shift < W) {
+			word = words[i + word_shift] >> bit_shift;
+			if (bit_shift != 0 && i + word_shift + 1 < W) {
+				word |= words[i + word_shift + 1] << (64 - bit_shift);
+			}
+		}
+		result[i] = word;
+	}
+	return 0;
+}
+
+// Rotates the kDataBits stored bits left by shift modulo kDataBits.
+template <int Bits = kSignificantBits>
+constexpr bool _rotateLeftStored(std::uint64_t words[_uintLayout<Bits>::kDataWords], std::uint64_t shift) {
+	using Layout = _uintLayout<Bits>;
+	constexpr int W = Layout::kDataWords;
+	int shift_mod = static_cast<int>(shift % Layout::kDataBits);
+	if (shift_mod == 0) return 0;
+	// The words between W zero words on either side, so that both shifts index without
+	// branching on the shift; a shift by 0 bits takes nothing from the neighbouring word.
+	std::uint64_t padded[3 * W] = {};
+	std::copy_n(words, W, padded + W);
+	int left_words = shift_mod / 64;
+	int left_bits = shift_mod % 64;
+	int right_words = (Layout::kDataBits - shift_mod) / 64;
+	int right_bits = (Layout::kDataBits - shift_mod) % 64;
+	for (int i = 0; i < W; ++i) {
+		const std::uint64_t* left = padded + W + i - left_words;
+		const std::uint64_t* right = padded + W + i + right_words;
+		words[i] = (left[0] << left_bits) | ((left[-1] >> 1) >> (63 - left_bits)) | (right[0] >> right_bits) | ((right[1] << 1) << (63 - right_bits));
+	}
+	words[W - 1] &= Layout::kTopDataWordMask;
+	return 0;
+}
+
+template <int Bits = kSignificantBits>
+constexpr bool _rotateRightStored(std::uint64_t words[_uintLayout<Bits>::kDataWords], std::uint64_t shift) {
+	int shift_mod = static_cast<int>(shift % _uintLayout<Bits>::kDataBits);
+	if (shift_mod == 0) return 0;
+	return _rotateLeftStored<Bits>(words, static_cast<std::uint64_t>(_uintLayout<Bits>::kDataBits - shift_mod));
+}
+
+template <int Bits = kSignificantBits>
+constexpr bool _alignStored(std::uint64_t stored[_uintLayout<Bits>::kDataWords], std::uint64_t from_shift, std::uint64_t to_shift) {
+	constexpr int kBits = _uintLayout<Bits>::kDataBits;
+	int delta = static_cast<int>(to_shift % kBits) - static_cast<int>(from_shift % kBits);
+	if (delta < 0) {
+		delta += kBits;
+	}
+	return _rotateLeftStored<Bits>(stored, static_cast<std::uint64_t>(delta));
+}
+
+// The padding bits, canonical bits Bits and up, of a payload stored with the given shift.
+template <int Bits = kSignificantBits>
+constexpr bool _storedPaddingMask(std::uint64_t padding[_uintLayout<Bits>::kDataWords], std::uint64_t shift) {
+	using Layout = _uintLayout<Bits>;
+	int start = static_cast<int>((Bits + shift % Layout::kDataBits) % Layout::kDataBits);
+	int head = std::min(Layout::kPaddingBits, Layout::kDataBits - start);
+	std::uint64_t head_bits = (1ULL << head) - 1ULL;
+	int word = start / 64;
+	int bit = start % 64;
+	for (int i = 0; i < Layout::kDataWords; ++i) {
+		std::uint64_t low = i == word ? head_bits << bit : 0;
+		std::uint64_t high = i == word + 1 ? (head_bits >> 1) >> (63 - bit) : 0;
+		padding[i] = low | high;
+	}
+	// The bits past the end of the payload wrap around to bit 0.
+	padding[0] |= (1ULL << (Layout::kPaddingBits - head)) - 1ULL;
+	return 0;
+}
+
+template <int Bits = kSignificantBits>
+constexpr bool _clearStoredPadding(std::uint64_t stored[_uintLayout<Bits>::kDataWords], std::uint64_t shift) {
+	using Layout = _uintLayout<Bits>;
+	std::uint64_t padding[Layout::kDataWords];
+	_storedPaddingMask<Bits>(padding, shift);
+	for (int i = 0; i < Layout::kDataWords; ++i) {
+		stored[i] &= ~padding[i];
+	}
+	return 0;
+}
+
+// Loads both payloads rotated by the lhs shift so that they can be compared word by word,
+// and returns that shift modulo kDataBits, the rotation _storedCompare needs. Padding bits
+// are cleared, since they are not part of the value.
+template <int Bits>
+constexpr std::uint64_t _loadAligned(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs, std::uint64_t lhs_stored[_uintLayout<Bits>::kDataWords], std::uint64_t rhs_stored[_uintLayout<Bits>::kDataWords]) {
+	constexpr int kBits = _uintLayout<Bits>::kDataBits;
+	_uintShift<Bits> lhs_shift{};
+	_uintShift<Bits> rhs_shift{};
+	_loadStored(lhs, lhs_stored, lhs_shift);
+	_loadStored(rhs, rhs_stored, rhs_shift);
+	std::uint64_t rotation = _shiftMod(lhs_shift, kBits);
+	_alignStored<Bits>(rhs_stored, _shiftMod(rhs_shift, kBits), rotation);
+	_clearStoredPadding<Bits>(lhs_stored, rotation);
+	_clearStoredPadding<Bits>(rhs_stored, rotation);
+	return rotation;
+}
+
+constexpr int _highestSetBit64(std::uint64_t word) {
+	return 63 - std::countl_zero(word);
+}
+
+template <int W = kNumDataWords>
+constexpr int _highestSetBit(const std::uint64_t words[W]) {
+	for (int i = W - 1; i >= 0; --i) {
+		if (words[i] != 0) {
+			return i * 64 + _highestSetBit64(words[i]);
+		}
+	}
+	return -1;
+}
+
+// Orders two payloads stored with the same shift without rotating them back.
+// Stored bits below the rotation hold the most significant canonical bits.
+// -1, 0 or 1 as the value in lhs_stored is below, equal to or above the one in rhs_stored.
+template <int Bits = kSignificantBits>
+constexpr int _storedCompare(const std::uint64_t lhs_stored[_uintLayout<Bits>::kDataWords], const std::uint64_t rhs_stored[_uintLayout<Bits>::kDataWords], std::uint64_t shift) {
+	using Layout = _uintLayout<Bits>;
+	int rotation = static_cast<int>(shift % Layout::kDataBits);
+	std::uint64_t wrapped[Layout::kDataWords];
+	std::uint64_t rest[Layout::kDataWords];
+	for (int i = 0; i < Layout::kDataWords; ++i) {
+		int low_bit = i * 64;
+		std::uint64_t wrapped_mask = 0;
+		if (rotation >= low_bit + 64) {
+			wrapped_mask = ~0ULL;
+		} else if (rotation > low_bit) {
+			wrapped_mask = (1ULL << (rotation - low_bit)) - 1ULL;
+		}
+		std::uint64_t diff = lhs_stored[i] ^ rhs_stored[i];
+		wrapped[i] = diff & wrapped_mask;
+		rest[i] = diff & ~wrapped_mask;
+	}
+	int bit = _highestSetBit<Layout::kDataWords>(wrapped);
+	if (bit < 0) {
+		bit = _highestSetBit<Layout::kDataWords>(rest);
+	}
+	if (bit < 0) {
+		return 0;
+	}
+	return ((rhs_stored[bit / 64] >> (bit % 64)) & 1ULL) != 0 ? -1 : 1;
+}
+
+template <int Bits = kSignificantBits>
+constexpr bool _storedLess(const std::uint64_t lhs_stored[_uintLayout<Bits>::kDataWords], const std::uint64_t rhs_stored[_uintLayout<Bits>::kDataWords], std::uint64_t shift) {
+	return _storedCompare<Bits>(lhs_stored, rhs_stored, shift) < 0;
+}
+
+template <int Bits>
+constexpr bool _reshiftInPlace(uint_t<Bits>& value, _uintShift<Bits> new_shift) {
+	using Layout = _uintLayout<Bits>;
+	std::uint64_t stored[Layout::kDataWords];
+	_uintShift<Bits> shift{};
+	_loadStored(value, stored, shift);
+	new_shift = _maskShift<Bits>(new_shift);
+	_alignStored<Bits>(stored, _shiftMod(shift, Layout::kDataBits), _shiftMod(new_shift, Layout::kDataBits));
+	return _storeStored(value, stored, new_shift);
+}
+
+// _reshiftInPlace that also clears the padding, as a decode and encode would.
+template <int Bits>
+constexpr bool _reshiftCanonicalInPlace(uint_t<Bits>& value, _uintShift<Bits> new_shift) {
+	using Layout = _uintLayout<Bits>;
+	std::uint64_t stored[Layout::kDataWords];
+	_uintShift<Bits> shift{};
+	_loadStored(value, stored, shift);
+	new_shift = _maskShift<Bits>(new_shift);
+	std::uint64_t rotation = _shiftMod(new_shift, Layout::kDataBits);
+	_alignStored<Bits>(stored, _shiftMod(shift, Layout::kDataBits), rotation);
+	_clearStoredPadding<Bits>(stored, rotation);
+	return _storeStored(value, stored, new_shift);
+}
+
+template <int Bits>
+constexpr uint_t<Bits> _withShift(const uint_t<Bits>& value, _uintShift<Bits> new_shift) {
+	uint_t<Bits> result = value;
+	_reshiftInPlace(result, new_shift);
+	return result;
+}
+
+// Rotates a loaded payload back to canonical order and clears the padding in the top limb.
+template <int Bits = kSignificantBits>
+constexpr bool _decodeStored(std::uint64_t stored[_uintLayout<Bits>::kDataWords], std::uint64_t shift) {
+	_rotateRightStored<Bits>(stored, shift);
+	stored[_uintLayout<Bits>::kLimbs - 1] &= _uintLayout<Bits>::kTopLimbMask;
+	return 0;
+}
+
+// The codec between a value and its limbs. A width whose stored bits need one word more
+// than its limbs goes through a stored buffer; that extra word only holds padding.
+template <int Bits>
+constexpr bool _loadLimbs(const uint_t<Bits>& value, std::uint64_t limbs[_uintLayout<Bits>::kLimbs], _uintShift<Bits>& out_shift) {
+	using Layout = _uintLayout<Bits>;
+	if constexpr (Layout::kDataWords == Layout::kLimbs) {
+		_loadStored(value, limbs, out_shift);
+		return _decodeStored<Bits>(limbs, _shiftMod(out_shift, Layout::kDataBits));
+	} else {
+		std::uint64_t stored[Layout::kDataWords];
+		_loadStored(value, stored, out_shift);
+		_decodeStored<Bits>(stored, _shiftMod(out_shift, Layout::kDataBits));
+		std::copy_n(stored, Layout::kLimbs, limbs);
+		return 0;
+	}
+}
+
+template <int Bits>
+constexpr bool _storeLimbs(uint_t<Bits>& value, const std::uint64_t limbs[_uintLayout<Bits>::kLimbs], _uintShift<Bits> shift) {
+	using Layout = _uintLayout<Bits>;
+	shift = _maskShift<Bits>(shift);
+	std::uint64_t stored[Layout::kDataWords] = {};
+	std::copy_n(limbs, Layout::kLimbs, stored);
+	stored[Layout::kLimbs - 1] &= Layout::kTopLimbMask;
+	_rotateLeftStored<Bits>(stored, _shiftMod(shift, Layout::kDataBits));
+	return _storeStored(value, stored, shift);
+}
+
+// The uint239_t codec calls, counted as decode and encode.
+constexpr bool _decodeToLimbs(const uint239_t& value, std::uint64_t limbs[kNumLimbs], std::uint64_t& out_shift) {
+	BIGINT_STATS_SCOPE(decode);
+	return _loadLimbs(value, limbs, out_shift);
+}
+
+constexpr bool _encodeInto(uint239_t& value, const std::uint64_t limbs[kNumLimbs], std::uint64_t shift) {
+	BIGINT_STATS_SCOPE(encode);
+	return _storeLimbs(value, limbs, shift);
+}
+
+constexpr uint239_t _encodeFromLimbs(const std::uint64_t limbs[kNumLimbs], std::uint64_t shift) {
+	uint239_t result{};
+	_encodeInto(result, limbs, shift);
+	return result;
+}
+
+constexpr std::uint64_t _addCarry64(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& carry) {
+	std::uint64_t sum = lhs + rhs;
+	std::uint64_t carry_out = static_cast<std::uint64_t>(sum < lhs);
+	std::uint64_t result = sum + carry;
+	carry_out |= static_cast<std::uint64_t>(result < sum);
+	carry = carry_out;
+	return result;
+}
+
+constexpr std::uint64_t _subBorrow64(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& borrow) {
+	std::uint64_t diff = lhs - rhs;
+	std::uint64_t borrow_out = static_cast<std::uint64_t>(lhs < rhs);
+	std::uint64_t result = diff - borrow;
+	borrow_out |= static_cast<std::uint64_t>(diff < borrow);
+	borrow = borrow_out;
+	return result;
+}
+
+// Returns the low word of lhs * rhs + addend + carry and leaves the high word in carry.
+constexpr std::uint64_t _mulAdd64(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t addend, std::uint64_t& carry) {
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs + addend + carry;
+	carry = static_cast<std::uint64_t>(product >> 64);
+	return static_cast<std::uint64_t>(product);
+#else
+	std::uint64_t lhs_lo = lhs & 0xFFFFFFFFULL;
+	std::uint64_t lhs_hi = lhs >> 32;
+	std::uint64_t rhs_lo = rhs & 0xFFFFFFFFULL;
+	std::uint64_t rhs_hi = rhs >> 32;
+	std::uint64_t lo_lo = lhs_lo * rhs_lo;
+	std::uint64_t hi_lo = lhs_hi * rhs_lo;
+	std::uint64_t lo_hi = lhs_lo * rhs_hi;
+	std::uint64_t hi_hi = lhs_hi * rhs_hi;
+	std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+	std::uint64_t low = (cross << 32) | (lo_lo & 0xFFFFFFFFULL);
+	std::uint64_t high = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+	std::uint64_t add_carry = 0;
+	low = _addCarry64(low, addend, add_carry);
+	high += add_carry;
+	add_carry = 0;
+	low = _addCarry64(low, carry, add_carry);
+	high += add_carry;
+	carry = high;
+	return low;
+#endif
+}
+
+template <int Words>
+constexpr _wideShift<Words> operator+(const _wideShift<Words>& lhs, const _wideShift<Words>& rhs) {
+	_wideShift<Words> sum;
+	std::uint64_t carry = 0;
+	for (int i = 0; i < Words; ++i) {
+		sum.words[i] = _addCarry64(lhs.words[i], rhs.words[i], carry);
+	}
+	return sum;
+}
+
+template <int Words>
+constexpr _wideShift<Words> operator-(const _wideShift<Words>& lhs, const _wideShift<Words>& rhs) {
+	_wideShift<Words> diff;
+	std::uint64_t borrow = 0;
+	for (int i = 0; i < Words; ++i) {
+		diff.words[i] = _subBorrow64(lhs.words[i], rhs.words[i], borrow);
+	}
+	return diff;
+}
+
+// The kernels below work on N little-endian limbs; the ones named for a width (Bits) also
+// wrap their result to it by masking the top limb.
+template <int N = kNumLimbs>
+constexpr bool _limbsIsZero(const std::uint64_t limbs[N]) {
+	std::uint64_t any = 0;
+	for (int i = 0; i < N; ++i) {
+		any |= limbs[i];
+	}
+	return any == 0;
+}
+
+template <int N = kNumLimbs>
+constexpr bool _limbsIsOne(const std::uint64_t limbs[N]) {
+	std::uint64_t rest = limbs[0] ^ 1ULL;
+	for (int i = 1; i < N; ++i) {
+		rest |= limbs[i];
+	}
+	return rest == 0;
+}
+
+template <int N = kNumLimbs>
+constexpr bool _limbsEqual(const std::uint64_t lhs_limbs[N], const std::uint64_t rhs_limbs[N]) {
+	std::uint64_t diff = 0;
+	for (int i = 0; i < N; ++i) {
+		diff |= lhs_limbs[i] ^ rhs_limbs[i];
+	}
+	return diff == 0;
+}
+
+template <int N = kNumLimbs>
+constexpr bool _limbsLess(const std::uint64_t lhs_limbs[N], const std::uint64_t rhs_limbs[N]) {
+	for (int i = N - 1; i >= 0; --i) {
+		if (lhs_limbs[i] != rhs_limbs[i]) {
+			return lhs_limbs[i] < rhs_limbs[i];
+		}
+	}
+	return false;
+}
+
+template <int Bits = kSignificantBits>
+constexpr bool _limbsAdd(const std::uint64_t lhs_limbs[_uintLayout<Bits>::kLimbs], const std::uint64_t rhs_limbs[_uintLayout<Bits>::kLimbs], std::uint64_t result_limbs[_uintLayout<Bits>::kLimbs]) {
+	constexpr int kLimbs = _uintLayout<Bits>::kLimbs;
+	std::uint64_t carry = 0;
+	for (int i = 0; i < kLimbs; ++i) {
+		result_limbs[i] = _addCarry64(lhs_limbs[i], rhs_limbs[i], carry);
+	}
+	result_limbs[kLimbs - 1] &= _uintLayout<Bits>::kTopLimbMask;
+	return 0;
+}
+
+template <int Bits = kSignificantBits>
+constexpr bool _limbsSub(const std::uint64_t lhs_limbs[_uintLayout<Bits>::kLimbs], const std::uint64_t rhs_limbs[_uintLayout<Bits>::kLimbs], std::uint64_t result_limbs[_uintLayout<Bits>::kLimbs]) {
+	constexpr int kLimbs = _uintLayout<Bits>::kLimbs;
+	std::uint64_t borrow = 0;
+	for (int i = 0; i < kLimbs; ++i) {
+		result_limbs[i] = _subBorrow64(lhs_limbs[i], rhs_limbs[i], borrow);
+	}
+	result_limbs[kLimbs - 1] &= _uintLayout<Bits>::kTopLimbMask;
+	return 0;
+}
+
+// Two's complement modulo 2^(64 N), so that a subtracted product can be accumulated.
+template <int N = kNumLimbs>
+constexpr bool _limbsNegate(std::uint64_t limbs[N]) {
+	std::uint64_t borrow = 0;
+	for (int i = 0; i < N; ++i) {
+		limbs[i] = _subBorrow64(0, limbs[i], borrow);
+	}
+	return 0;
+}
+
+// Fused multiply-add: acc += lhs * rhs modulo 2^(64 N). The top limb is left unmasked,
+// which is harmless for any width of N limbs; acc must not alias the factors.
+template <int N = kNumLimbs>
+constexpr bool _limbsMulAcc(const std::uint64_t lhs_limbs[N], const std::uint64_t rhs_limbs[N], std::uint64_t acc_limbs[N]) {
+	for (int rhs_index = 0; rhs_index < N; ++rhs_index) {
+		if (rhs_limbs[rhs_index] == 0) continue;
+		std::uint64_t carry = 0;
+		for (int lhs_index = 0; lhs_index + rhs_index < N; ++lhs_index) {
+			acc_limbs[lhs_index + rhs_index] = _mulAdd64(lhs_limbs[lhs_index], rhs_limbs[rhs_index], acc_limbs[lhs_index + rhs_index], carry);
+		}
+	}
+	return 0;
+}
+
+template <int Bits = kSignificantBits>
+constexpr bool _limbsMul(const std::uint64_t lhs_limbs[_uintLayout<Bits>::kLimbs], const std::uint64_t rhs_limbs[_uintLayout<Bits>::kLimbs], std::uint64_t result_limbs[_uintLayout<Bits>::kLimbs]) {
+	constexpr int kLimbs = _uintLayout<Bits>::kLimbs;
+	std::uint64_t tmp_limbs[kLimbs] = {0};
+	_limbsMulAcc<kLimbs>(lhs_limbs, rhs_limbs, tmp_limbs);
+	tmp_limbs[kLimbs - 1] &= _uintLayout<Bits>::kTopLimbMask;
+	std::copy_n(tmp_limbs, kLimbs, result_limbs);
+	return 0;
+}
+
+// lhs * rhs + addend over 2 * kNumLimbs limbs. All three are below 2^239, so the sum
+// stays below 2^478 and the wide limbs never overflow.
+constexpr bool _limbsMulWide(const std::uint64_t lhs_limbs[kNumLimbs], const std::uint64_t rhs_limbs[kNumLimbs], const std::uint64_t addend_limbs[kNumLimbs], std::uint64_t wide_limbs[2 * kNumLimbs]) {
+	std::copy_n(addend_limbs, kNumLimbs, wide_limbs);
+	std::fill_n(wide_limbs + kNumLimbs, kNumLimbs, 0ULL);
+	for (int rhs_index = 0; rhs_index < kNumLimbs; ++rhs_index) {
+		std::uint64_t carry = 0;
+		for (int lhs_index = 0; lhs_index < kNumLimbs; ++lhs_index) {
+			wide_limbs[lhs_index + rhs_index] = _mulAdd64(lhs_limbs[lhs_index], rhs_limbs[rhs_index], wide_limbs[lhs_index + rhs_index], carry);
+		}
+		wide_limbs[rhs_index + kNumLimbs] = carry;
+	}
+	return 0;
+}
+
+// Splits a wide value at bit 239 into two sets of limbs.
+constexpr bool _limbsSplitWide(const std::uint64_t wide_limbs[2 * kNumLimbs], std::uint64_t low_limbs[kNumLimbs], std::uint64_t high_limbs[kNumLimbs]) {
+	constexpr int kHighWord = kSignificantBits / 64;
+	constexpr int kHighBit = kSignificantBits % 64;
+	for (int i = 0; i < kNumLimbs; ++i) {
+		std::uint64_t next = i + kHighWord + 1 < 2 * kNumLimbs ? wide_limbs[i + kHighWord + 1] : 0;
+		high_limbs[i] = (wide_limbs[i + kHighWord] >> kHighBit) | (next << (64 - kHighBit));
+	}
+	std::copy_n(wide_limbs, kNumLimbs, low_limbs);
+	low_limbs[kNumLimbs - 1] &= kTopLimbMask;
+	return 0;
+}
+
+// Divides high:low by divisor; requires high < divisor.
+constexpr std::uint64_t _divWide64(std::uint64_t high, std::uint64_t low, std::uint64_t divisor, std::uint64_t& remainder) {
+#if defined(__x86_64__) && defined(__GNUC__)
+	if (!std::is_constant_evaluated()) {
+		std::uint64_t quotient = 0;
+		__asm__("divq %4" : "=a"(quotient), "=d"(remainder) : "a"(low), "d"(high), "rm"(divisor));
+		return quotient;
+	}
+#endif
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 dividend = (static_cast<unsigned __int128>(high) << 64) | low;
+	remainder = static_cast<std::uint64_t>(dividend % divisor);
+	return static_cast<std::uint64_t>(dividend / divisor);
+#else
+	const std::uint64_t base = 1ULL << 32;
+	int norm_shift = 63 - _highestSetBit64(divisor);
+	divisor <<= norm_shift;
+	std::uint64_t divisor_hi = divisor >> 32;
+	std::uint64_t divisor_lo = divisor & 0xFFFFFFFFULL;
+	std::uint64_t high_norm = norm_shift == 0 ? high : (high << norm_shift) | (low >> (64 - norm_shift));
+	std::uint64_t low_norm = low << norm_shift;
+	std::uint64_t low_hi = low_norm >> 32;
+	std::uint64_t low_lo = low_norm & 0xFFFFFFFFULL;
+	std::uint64_t q1 = high_norm / divisor_hi;
+	std::uint64_t rhat = high_norm - q1 * divisor_hi;
+	while (q1 >= base || q1 * divisor_lo > base * rhat + low_hi) {
+		--q1;
+		rhat += divisor_hi;
+		if (rhat >= base) break;
+	}
+	std::uint64_t middle = high_norm * base + low_hi - q1 * divisor;
+	std::uint64_t q0 = middle / divisor_hi;
+	rhat = middle - q0 * divisor_hi;
+	while (q0 >= base || q0 * divisor_lo > base * rhat + low_lo) {
+		--q0;
+		rhat += divisor_hi;
+		if (rhat >= base) break;
+	}
+	remainder = (middle * base + low_lo - q0 * divisor) >> norm_shift;
+	return q1 * base + q0;
+#endif
+}
+
+template <int N = kNumLimbs>
+constexpr int _limbsLength(const std::uint64_t limbs[N]) {
+	int length = N;
+	while (length > 0 && limbs[length - 1] == 0) {
+		--length;
+	}
+	return length;
+}
+
+// quotient_limbs may be dividend_limbs.
+template <int N = kNumLimbs>
+constexpr bool _limbsDivWord(const std::uint64_t dividend_limbs[N], std::uint64_t divisor, std::uint64_t quotient_limbs[N], std::uint64_t& remainder) {
+	std::uint64_t rem = 0;
+	for (int i = N - 1; i >= 0; --i) {
+		quotient_limbs[i] = _divWide64(rem, dividend_limbs[i], divisor, rem);
+	}
+	remainder = rem;
+	return 0;
+}
+
+// Knuth, TAOCP vol. 2, 4.3.1, Algorithm D for divisors of two or more limbs.
+template <int N = kNumLimbs>
+constexpr bool _limbsDivKnuth(const std::uint64_t dividend_limbs[N], int dividend_length, const std::uint64_t divisor_limbs[N], int divisor_length, std::uint64_t quotient_limbs[N], std::uint64_t remainder_limbs[N]) {
+	int m = dividend_length;
+	int n = divisor_length;
+	int norm_shift = 63 - _highestSetBit64(divisor_limbs[n - 1]);
+	std::uint64_t vn[N] = {0};
+	std::uint64_t un[N + 1] = {0};
+	for (int i = n - 1; i > 0; --i) {
+		vn[i] = norm_shift == 0 ? divisor_limbs[i] : (divisor_limbs[i] << norm_shift) | (divisor_limbs[i - 1] >> (64 - norm_shift));
+	}
+	vn[0] = divisor_limbs[0] << norm_shift;
+	un[m] = norm_shift == 0 ? 0 : dividend_limbs[m - 1] >> (64 - norm_shift);
+	for (int i = m - 1; i > 0; --i) {
+		un[i] = norm_shift == 0 ? dividend_limbs[i] : (dividend_limbs[i] << norm_shift) | (dividend_limbs[i - 1] >> (64 - norm_shift));
+	}
+	un[0] = dividend_limbs[0] << norm_shift;
+
+	std::fill_n(quotient_limbs, N, 0ULL);
+	for (int j = m - n; j >= 0; --j) {
+		std::uint64_t qhat = 0;
+		std::uint64_t rhat = 0;
+		bool rhat_overflow = false;
+		if (un[j + n] >= vn[n - 1]) {
+			qhat = ~0ULL;
+			rhat = un[j + n - 1] + vn[n - 1];
+			rhat_overflow = rhat < vn[n - 1];
+		} else {
+			qhat = _divWide64(un[j + n], un[j + n - 1], vn[n - 1], rhat);
+		}
+		while (!rhat_overflow) {
+			std::uint64_t product_hi = 0;
+			std::uint64_t product_lo = _mulAdd64(qhat, vn[n - 2], 0, product_hi);
+			if (product_hi < rhat || (product_hi == rhat && product_lo <= un[j + n - 2])) break;
+			--qhat;
+			rhat += vn[n - 1];
+			rhat_overflow = rhat < vn[n - 1];
+		}
+
+		std::uint64_t carry = 0;
+		std::uint64_t borrow = 0;
+		for (int i = 0; i < n; ++i) {
+			std::uint64_t product = _mulAdd64(qhat, vn[i], 0, carry);
+			un[i + j] = _subBorrow64(un[i + j], product, borrow);
+		}
+		un[j + n] = _subBorrow64(un[j + n], carry, borrow);
+		if (borrow) {
+			--qhat;
+			carry = 0;
+			for (int i = 0; i < n; ++i) {
+				un[i + j] = _addCarry64(un[i + j], vn[i], carry);
+			}
+			un[j + n] += carry;
+		}
+		quotient_limbs[j] = qhat;
+	}
+
+	std::fill_n(remainder_limbs, N, 0ULL);
+	for (int i = 0; i < n; ++i) {
+		remainder_limbs[i] = norm_shift == 0 ? un[i] : (un[i] >> norm_shift) | (un[i + 1] << (64 - norm_shift));
+	}
+	return 0;
+}
+
+template <int N = kNumLimbs>
+constexpr bool _limbsDivMod(const std::uint64_t dividend_limbs[N], const std::uint64_t divisor_limbs[N], std::uint64_t quotient_limbs[N], std::uint64_t remainder_limbs[N]) {
+	int divisor_length = _limbsLength<N>(divisor_limbs);
+	if (divisor_length == 0) {
+		throw std::runtime_error("uint_t division by zero");
+	}
+	int dividend_length = _limbsLength<N>(dividend_limbs);
+	if (dividend_length < divisor_length || _limbsLess<N>(dividend_limbs, divisor_limbs)) {
+		std::copy_n(dividend_limbs, N, remainder_limbs);
+		std::fill_n(quotient_limbs, N, 0ULL);
+		return 0;
+	}
+
+	std::uint64_t top = divisor_limbs[divisor_length - 1];
+	bool is_power_of_two = (top & (top - 1)) == 0;
+	for (int i = 0; i < divisor_length - 1 && is_power_of_two; ++i) {
+		is_power_of_two = divisor_limbs[i] == 0;
+	}
+	if (is_power_of_two) {
+		int exponent = (divisor_length - 1) * 64 + _highestSetBit64(top);
+		std::uint64_t remainder_tmp[N];
+		for (int i = 0; i < N; ++i) {
+			int low_bit = i * 64;
+			std::uint64_t mask = 0;
+			if (exponent >= low_bit + 64) {
+				mask = ~0ULL;
+			} else if (exponent > low_bit) {
+				mask = (1ULL << (exponent - low_bit)) - 1ULL;
+			}
+			remainder_tmp[i] = dividend_limbs[i] & mask;
+		}
+		_wordsShiftRight<N>(dividend_limbs, exponent, quotient_limbs);
+		std::copy_n(remainder_tmp, N, remainder_limbs);
+		return 0;
+	}
+
+	if (divisor_length == 1) {
+		std::uint64_t remainder = 0;
+		_limbsDivWord<N>(dividend_limbs, divisor_limbs[0], quotient_limbs, remainder);
+		std::fill_n(remainder_limbs, N, 0ULL);
+		remainder_limbs[0] = remainder;
+		return 0;
+	}
+
+	return _limbsDivKnuth<N>(dividend_limbs, dividend_length, divisor_limbs, divisor_length, quotient_limbs, remainder_limbs);
+}
+
+// Multiplies by a word and adds a word; returns true when the exact result needs more than Bits bits.
+template <int Bits = kSignificantBits>
+constexpr bool _limbsMulAddWord(std::uint64_t limbs[_uintLayout<Bits>::kLimbs], std::uint64_t multiplier, std::uint64_t addend) {
+	using Layout = _uintLayout<Bits>;
+	std::uint64_t carry = addend;
+	for (int i = 0; i < Layout::kLimbs; ++i) {
+		limbs[i] = _mulAdd64(limbs[i], multiplier, 0, carry);
+	}
+	bool overflow = carry != 0 || (limbs[Layout::kLimbs - 1] & ~Layout::kTopLimbMask) != 0;
+	limbs[Layout::kLimbs - 1] &= Layout::kTopLimbMask;
+	return overflow;
+}
+
+constexpr std::uint64_t _loadLittle64(const char* bytes) {
+	std::uint64_t chunk = 0;
+	for (int i = 7; i >= 0; --i) {
+		chunk = (chunk << 8) | static_cast<std::uint8_t>(bytes[i]);
+	}
+	return chunk;
+}
+
+constexpr bool _isEightDigits(std::uint64_t chunk) {
+	return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+}
+
+constexpr std::uint64_t _parseEightDigits(std::uint64_t chunk) {
+	chunk -= 0x3030303030303030ULL;
+	chunk = (chunk * 10) + (chunk >> 8);
+	chunk = (((chunk & 0x000000FF000000FFULL) * 0x000F424000000064ULL) + (((chunk >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+	return chunk;
+}
+
+constexpr int _digitValue(char symbol) {
+	if (symbol >= '0' && symbol <= '9') return symbol - '0';
+	if (symbol >= 'a' && symbol <= 'z') return symbol - 'a' + 10;
+	if (symbol >= 'A' && symbol <= 'Z') return symbol - 'A' + 10;
+	return 64;
+}
+
+// Accumulates the leading run of decimal digits onto limbs, 19 digits per multiply-add.
+template <int Bits = kSignificantBits>
+constexpr const char* _accumulateDecimal(const char* first, const char* last, std::uint64_t limbs[_uintLayout<Bits>::kLimbs], bool& overflow) {
+	const char* p = first;
+	while (p < last) {
+		std::uint64_t chunk = 0;
+		int digits = 0;
+		while (digits + 8 <= kDecimalChunkDigits && last - p >= 8) {
+			std::uint64_t eight = _loadLittle64(p);
+			if (!_isEightDigits(eight)) break;
+			chunk = chunk * 100000000ULL + _parseEightDigits(eight);
+			p += 8;
+			digits += 8;
+		}
+		while (digits < kDecimalChunkDigits && p < last && *p >= '0' && *p <= '9') {
+			chunk = chunk * 10ULL + static_cast<std::uint64_t>(*p - '0');
+			++p;
+			++digits;
+		}
+		if (digits == 0) break;
+		overflow |= _limbsMulAddWord<Bits>(limbs, kPowersOf10[digits], chunk);
+		if (digits < kDecimalChunkDigits) break;
+	}
+	return p;
+}
+
+template <int Bits = kSignificantBits>
+constexpr const char* _accumulateDigits(const char* first, const char* last, int base, std::uint64_t limbs[_uintLayout<Bits>::kLimbs], bool& overflow) {
+	if (base == 10) {
+		return _accumulateDecimal<Bits>(first, last, limbs, overflow);
+	}
+	std::uint64_t chunk_limit = ~0ULL / static_cast<std::uint64_t>(base);
+	const char* p = first;
+	while (p < last) {
+		std::uint64_t chunk = 0;
+		std::uint64_t scale = 1;
+		while (scale <= chunk_limit && p < last && _digitValue(*p) < base) {
+			chunk = chunk * static_cast<std::uint64_t>(base) + static_cast<std::uint64_t>(_digitValue(*p));
+			scale *= static_cast<std::uint64_t>(base);
+			++p;
+		}
+		if (scale == 1) break;
+		overflow |= _limbsMulAddWord<Bits>(limbs, scale, chunk);
+	}
+	return p;
+}
+
+// FromString: every decimal digit of the string in order, whatever lies between them.
+template <int Bits = kSignificantBits>
+constexpr bool _accumulateString(const char* str, std::uint64_t limbs[_uintLayout<Bits>::kLimbs]) {
+	const char* last = str + std::char_traits<char>::length(str);
+	bool overflow = false;
+	for (const char* p = str; p < last;) {
+		if (*p < '0' || *p > '9') {
+			++p;
+			continue;
+		}
+		p = _accumulateDecimal<Bits>(p, last, limbs, overflow);
+	}
+	return 0;
+}
+
+// FromChars up to the encoding: limbs hold the value when the result has no error.
+template <int Bits = kSignificantBits>
+constexpr std::from_chars_result _parseChars(const char* first, const char* last, int base, std::uint64_t limbs[_uintLayout<Bits>::kLimbs]) {
+	if (base < 2 || base > 36) {
+		return {first, std::errc::invalid_argument};
+	}
+	bool overflow = false;
+	const char* end = _accumulateDigits<Bits>(first, last, base, limbs, overflow);
+	if (end == first) {
+		return {first, std::errc::invalid_argument};
+	}
+	if (overflow) {
+		return {end, std::errc::result_out_of_range};
+	}
+	return {end, std::errc()};
+}
+
+// Identity and absorbing operands are recognised on the stored payload, without rotating it.
+constexpr bool _storedIsZero(const uint239_t& value) {
+	std::uint8_t bits = 0;
+	for (int i = 0; i < kNumBytes; ++i) {
+		bits |= value.data[i];
+	}
+	return (bits & 0x7F) == 0;
+}
+
+constexpr bool _storedIsOne(const uint239_t& value) {
+	std::uint64_t stored[kNumDataWords];
+	std::uint64_t shift = 0;
+	_loadStored(value, stored, shift);
+	int count = 0;
+	for (int i = 0; i < kNumDataWords; ++i) {
+		count += std::popcount(stored[i]);
+	}
+	return count == 1 && _highestSetBit(stored) == static_cast<int>(shift % kDataBits);
+}
+
+// Bodies of the arithmetic operators. At run time they are reached through the kernel
+// table, so they are compiled for every CPU tier; the result may alias an operand.
+constexpr bool _addInto(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	_decodeToLimbs(lhs, lhs_limbs, lhs_shift);
+	_decodeToLimbs(rhs, rhs_limbs, rhs_shift);
+	_limbsAdd(lhs_limbs, rhs_limbs, lhs_limbs);
+	return _encodeInto(result, lhs_limbs, lhs_shift + rhs_shift);
+}
+
+constexpr bool _subInto(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	_decodeToLimbs(lhs, lhs_limbs, lhs_shift);
+	_decodeToLimbs(rhs, rhs_limbs, rhs_shift);
+	_limbsSub(lhs_limbs, rhs_limbs, lhs_limbs);
+	return _encodeInto(result, lhs_limbs, lhs_shift - rhs_shift);
+}
+
+// _storedPaddingMask for every rotation of a uint239_t payload, looked up by the in-place
+// sum instead of being built for each call.
+struct _storedPaddingTable {
+	std::uint64_t masks[kDataBits][kNumDataWords];
+};
+
+constexpr _storedPaddingTable _makeStoredPaddingTable() {
+	_storedPaddingTable table{};
+	for (int rotation = 0; rotation < kDataBits; ++rotation) {
+		_storedPaddingMask(table.masks[rotation], static_cast<std::uint64_t>(rotation));
+	}
+	return table;
+}
+
+inline constexpr _storedPaddingTable kStoredPadding = _makeStoredPaddingTable();
+
+// lhs += rhs or lhs -= rhs on the stored payloads, without rotating either back to
+// canonical order. Rotating by the result shift multiplies by a power of two modulo
+// 2^kDataBits - 1, so the payloads add with an end-around carry. Both are brought to the
+// result shift, two rotations where a decode, decode and encode take three, and neither
+// one when the shifts already match. With the padding cleared the sum stays below
+// 2^(kSignificantBits + 1); a difference first gets 2^kSignificantBits set in the lowest
+// padding bit of lhs, so that it cannot go negative.
+template <bool Subtract>
+constexpr bool _addStoredInPlace(uint239_t& lhs, const uint239_t& rhs) {
+	std::uint64_t lhs_stored[kNumDataWords];
+	std::uint64_t rhs_stored[kNumDataWords];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	_loadStored(lhs, lhs_stored, lhs_shift);
+	_loadStored(rhs, rhs_stored, rhs_shift);
+	std::uint64_t shift = (Subtract ? lhs_shift - rhs_shift : lhs_shift + rhs_shift) & kShiftMask35;
+	std::uint64_t rotation = shift % kDataBits;
+	_alignStored(lhs_stored, lhs_shift, rotation);
+	_alignStored(rhs_stored, rhs_shift, rotation);
+	// The padding is masked word by word inside the carry chain.
+	const std::uint64_t* padding = kStoredPadding.masks[rotation];
+	std::uint64_t carry = 0;
+	if constexpr (Subtract) {
+		int guard = static_cast<int>((kSignificantBits + rotation) % kDataBits);
+		for (int i = 0; i < kNumDataWords; ++i) {
+			std::uint64_t guard_bit = i == guard / 64 ? 1ULL << (guard % 64) : 0;
+			lhs_stored[i] = _subBorrow64((lhs_stored[i] & ~padding[i]) | guard_bit, rhs_stored[i] & ~padding[i], carry);
+		}
+		for (int i = 0; i < kNumDataWords; ++i) {
+			lhs_stored[i] = _subBorrow64(lhs_stored[i], 0, carry);
+		}
+	} else {
+		for (int i = 0; i < kNumDataWords; ++i) {
+			lhs_stored[i] = _addCarry64(lhs_stored[i] & ~padding[i], rhs_stored[i] & ~padding[i], carry);
+		}
+		carry = lhs_stored[kNumDataWords - 1] >> (kDataBits % 64);
+		for (int i = 0; i < kNumDataWords; ++i) {
+			lhs_stored[i] = _addCarry64(lhs_stored[i], 0, carry);
+		}
+	}
+	for (int i = 0; i < kNumDataWords; ++i) {
+		lhs_stored[i] &= ~padding[i];
+	}
+	lhs_stored[kNumDataWords - 1] &= kTopDataWordMask;
+	return _storeStored(lhs, lhs_stored, shift);
+}
+
+constexpr bool _mulInto(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	_decodeToLimbs(lhs, lhs_limbs, lhs_shift);
+	_decodeToLimbs(rhs, rhs_limbs, rhs_shift);
+	_limbsMul(lhs_limbs, rhs_limbs, lhs_limbs);
+	return _encodeInto(result, lhs_limbs, lhs_shift + rhs_shift);
+}
+
+// Either output may be null; both get the shift lhs - rhs.
+constexpr bool _divModInto(const uint239_t& lhs, const uint239_t& rhs, uint239_t* quotient, uint239_t* remainder) {
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	std::uint64_t quotient_limbs[kNumLimbs];
+	std::uint64_t remainder_limbs[kNumLimbs];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	_decodeToLimbs(lhs, lhs_limbs, lhs_shift);
+	_decodeToLimbs(rhs, rhs_limbs, rhs_shift);
+	_limbsDivMod(lhs_limbs, rhs_limbs, quotient_limbs, remainder_limbs);
+	if (quotient != nullptr) {
+		_encodeInto(*quotient, quotient_limbs, lhs_shift - rhs_shift);
+	}
+	if (remainder != nullptr) {
+		_encodeInto(*remainder, remainder_limbs, lhs_shift - rhs_shift);
+	}
+	return 0;
+}
+
+}
+}
+BIGINT_KERNEL_TARGET_END
+
+namespace bigint_impl {
+
+// Implementations picked once at startup from the CPU features, or from the
+// BIGINT_CPU_TIER environment variable (number_dispatch.cpp). Constant evaluation
+// never goes through the table.
+struct _kernelTable {
+	const char* name;
+	void (*decode)(const uint239_t& value, std::uint64_t limbs[kNumLimbs], std::uint64_t& shift);
+	void (*encode)(uint239_t& value, const std::uint64_t limbs[kNumLimbs], std::uint64_t shift);
+	void (*add)(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result);
+	void (*sub)(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result);
+	void (*mul)(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result);
+	void (*div_mod)(const uint239_t& lhs, const uint239_t& rhs, uint239_t* quotient, uint239_t* remainder);
+	void (*add_in_place)(uint239_t& lhs, const uint239_t& rhs);
+	void (*sub_in_place)(uint239_t& lhs, const uint239_t& rhs);
+	void (*add_batch)(const uint239_t* lhs, const uint239_t* rhs, uint239_t* result, std::size_t count);
+	void (*sub_batch)(const uint239_t* lhs, const uint239_t* rhs, uint239_t* result, std::size_t count);
+	void (*mul_batch)(const uint239_t* lhs, const uint239_t* rhs, uint239_t* result, std::size_t count);
+	void (*compare_batch)(const uint239_t* lhs, const uint239_t* rhs, int8_t* result, std::size_t count);
+	void (*decode_batch)(const uint239_t* values, uint239_work* result, std::size_t count);
+	void (*encode_batch)(const uint239_work* values, uint239_t* result, std::size_t count);
+};
+
+extern const _kernelTable* _activeKernels;
+
+constexpr void _kernelDecode(const uint239_t& value, std::uint64_t limbs[kNumLimbs], std::uint64_t& shift) {
+	if (std::is_constant_evaluated()) {
+		_decodeToLimbs(value, limbs, shift);
+	} else {
+		_activeKernels->decode(value, limbs, shift);
+	}
+}
+
+constexpr void _kernelEncode(uint239_t& value, const std::uint64_t limbs[kNumLimbs], std::uint64_t shift) {
+	if (std::is_constant_evaluated()) {
+		_encodeInto(value, limbs, shift);
+	} else {
+		_activeKernels->encode(value, limbs, shift);
+	}
+}
+
+constexpr void _kernelAdd(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	if (std::is_constant_evaluated()) {
+		_addInto(lhs, rhs, result);
+	} else {
+		_activeKernels->add(lhs, rhs, result);
+	}
+}
+
+constexpr void _kernelSub(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	if (std::is_constant_evaluated()) {
+		_subInto(lhs, rhs, result);
+	} else {
+		_activeKernels->sub(lhs, rhs, result);
+	}
+}
+
+constexpr void _kernelAddInPlace(uint239_t& lhs, const uint239_t& rhs) {
+	if (std::is_constant_evaluated()) {
+		_addStoredInPlace<false>(lhs, rhs);
+	} else {
+		_activeKernels->add_in_place(lhs, rhs);
+	}
+}
+
+constexpr void _kernelSubInPlace(uint239_t& lhs, const uint239_t& rhs) {
+	if (std::is_constant_evaluated()) {
+		_addStoredInPlace<true>(lhs, rhs);
+	} else {
+		_activeKernels->sub_in_place(lhs, rhs);
+	}
+}
+
+constexpr void _kernelMul(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	if (std::is_constant_evaluated()) {
+		_mulInto(lhs, rhs, result);
+	} else {
+		_activeKernels->mul(lhs, rhs, result);
+	}
+}
+
+constexpr void _kernelDivMod(const uint239_t& lhs, const uint239_t& rhs, uint239_t* quotient, uint239_t* remainder) {
+	if (std::is_constant_evaluated()) {
+		_divModInto(lhs, rhs, quotient, remainder);
+	} else {
+		_activeKernels->div_mod(lhs, rhs, quotient, remainder);
+	}
+}
+
+// Defined in number_parallel.cpp. Calls body(context, block) for every block below
+// block_count on the pool, the calling thread included, and returns once all are done.
+void _parallelRun(std::size_t block_count, void (*body)(void* context, std::size_t block), void* context);
+
+template <class Body>
+void _parallelFor(std::size_t block_count, Body& body) {
+	_parallelRun(block_count, [](void* context, std::size_t block) { (*static_cast<Body*>(context))(block); }, &body);
+}
+
+}
+
+constexpr uint32_t GetShift(const uint239_t& value) {
+	BIGINT_STATS_SCOPE(get_shift);
+	return static_cast<uint32_t>(bigint_impl::_loadShift(value) & 0xFFFFFFFFULL);
+}
+
+constexpr uint239_t FromInt(uint32_t value, uint32_t shift) {
+	BIGINT_STATS_SCOPE(from_int);
+	std::uint64_t limbs[bigint_impl::kNumLimbs] = {static_cast<std::uint64_t>(value)};
+	std::uint64_t shift_64 = static_cast<std::uint64_t>(shift);
+	return bigint_impl::_encodeFromLimbs(limbs, shift_64);
+}
+
+constexpr uint239_t FromString(const char* str, uint32_t shift) {
+	BIGINT_STATS_SCOPE(from_string);
+	std::uint64_t limbs[bigint_impl::kNumLimbs] = {0};
+	bigint_impl::_accumulateString(str, limbs);
+	std::uint64_t shift_64 = static_cast<std::uint64_t>(shift);
+	return bigint_impl::_encodeFromLimbs(limbs, shift_64);
+}
+
+constexpr std::from_chars_result FromChars(const char* first, const char* last, uint239_t& value, uint32_t shift, int base) {
+	BIGINT_STATS_SCOPE(from_chars);
+	std::uint64_t limbs[bigint_impl::kNumLimbs] = {0};
+	std::from_chars_result result = bigint_impl::_parseChars(first, last, base, limbs);
+	if (result.ec == std::errc()) {
+		value = bigint_impl::_encodeFromLimbs(limbs, static_cast<std::uint64_t>(shift));
+	}
+	return result;
+}
+
+constexpr std::from_chars_result FromChars(std::string_view str, uint239_t& value, uint32_t shift, int base) {
+	return FromChars(str.data(), str.data() + str.size(), value, shift, base);
+}
+
+constexpr uint239_t operator<<(const uint239_t& lhs, uint32_t shift) {
+	BIGINT_STATS_SCOPE(shift_left);
+	std::uint64_t new_shift = bigint_impl::_loadShift(lhs) + static_cast<std::uint64_t>(shift);
+	return bigint_impl::_withShift(lhs, new_shift);
+}
+
+constexpr uint239_t operator>>(const uint239_t& lhs, uint32_t shift) {
+	BIGINT_STATS_SCOPE(shift_right);
+	std::uint64_t modulus = (1ULL << 35);
+	std::uint64_t shift_64 = static_cast<std::uint64_t>(shift) & bigint_impl::kShiftMask35;
+	std::uint64_t new_shift = bigint_impl::_loadShift(lhs) + modulus - shift_64;
+	return bigint_impl::_withShift(lhs, new_shift);
+}
+
+constexpr bool operator==(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(equal);
+	std::uint64_t lhs_stored[bigint_impl::kNumDataWords];
+	std::uint64_t rhs_stored[bigint_impl::kNumDataWords];
+	bigint_impl::_loadAligned(lhs, rhs, lhs_stored, rhs_stored);
+	return bigint_impl::_limbsEqual(lhs_stored, rhs_stored);
+}
+
+constexpr bool operator!=(const uint239_t& lhs, const uint239_t& rhs) {
+	return !(lhs == rhs);
+}
+
+constexpr bool operator<(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(less);
+	std::uint64_t lhs_stored[bigint_impl::kNumDataWords];
+	std::uint64_t rhs_stored[bigint_impl::kNumDataWords];
+	std::uint64_t shift = bigint_impl::_loadAligned(lhs, rhs, lhs_stored, rhs_stored);
+	return bigint_impl::_storedLess(lhs_stored, rhs_stored, shift);
+}
+
+constexpr bool operator>(const uint239_t& lhs, const uint239_t& rhs) {
+	return rhs < lhs;
+}
+
+constexpr std::weak_ordering operator<=>(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(compare);
+	std::uint64_t lhs_stored[bigint_impl::kNumDataWords];
+	std::uint64_t rhs_stored[bigint_impl::kNumDataWords];
+	std::uint64_t shift = bigint_impl::_loadAligned(lhs, rhs, lhs_stored, rhs_stored);
+	int order = bigint_impl::_storedCompare(lhs_stored, rhs_stored, shift);
+	return order < 0 ? std::weak_ordering::less : order > 0 ? std::weak_ordering::greater : std::weak_ordering::equivalent;
+}
+
+static_assert(sizeof(uint239_sort_key_t::bytes) == (bigint_impl::kSignificantBits + 7) / 8, "uint239_sort_key_t must hold the significant bits");
+
+namespace bigint_impl {
+
+constexpr bool _limbsToSortKey(const std::uint64_t limbs[kNumLimbs], uint239_sort_key_t& key) {
+	constexpr int kKeyBytes = sizeof(key.bytes);
+	for (int i = 0; i < kKeyBytes; ++i) {
+		key.bytes[kKeyBytes - 1 - i] = static_cast<std::uint8_t>(limbs[i / 8] >> (i % 8 * 8));
+	}
+	return 0;
+}
+
+}
+
+constexpr uint239_sort_key_t SortKey(const uint239_t& value) {
+	BIGINT_STATS_SCOPE(sort_key);
+	std::uint64_t limbs[bigint_impl::kNumLimbs];
+	std::uint64_t shift = 0;
+	bigint_impl::_kernelDecode(value, limbs, shift);
+	uint239_sort_key_t key;
+	bigint_impl::_limbsToSortKey(limbs, key);
+	return key;
+}
+
+constexpr uint239_t operator+(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(add);
+	uint239_t result{};
+	bigint_impl::_kernelAdd(lhs, rhs, result);
+	return result;
+}
+
+constexpr uint239_t operator-(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(sub);
+	uint239_t result{};
+	bigint_impl::_kernelSub(lhs, rhs, result);
+	return result;
+}
+
+constexpr uint239_t operator*(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(mul);
+	uint239_t result{};
+	bigint_impl::_kernelMul(lhs, rhs, result);
+	return result;
+}
+
+constexpr uint239_divmod_t DivMod(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(div_mod);
+	uint239_divmod_t result{};
+	bigint_impl::_kernelDivMod(lhs, rhs, &result.quotient, &result.remainder);
+	return result;
+}
+
+constexpr uint239_t operator/(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(div);
+	uint239_t result{};
+	bigint_impl::_kernelDivMod(lhs, rhs, &result, nullptr);
+	return result;
+}
+
+constexpr uint239_t operator%(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(mod);
+	uint239_t result{};
+	bigint_impl::_kernelDivMod(lhs, rhs, nullptr, &result);
+	return result;
+}
+
+namespace bigint_impl {
+
+// One decode per operand and one schoolbook pass; either half may be skipped. The addend
+// is a reference plus a flag because GCC 12 cannot compare the address of a temporary
+// with nullptr during constant evaluation.
+constexpr bool _mulWideInto(const uint239_t& lhs, const uint239_t& rhs, const uint239_t& addend, bool with_addend, uint239_t* low, uint239_t* high) {
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	std::uint64_t addend_limbs[kNumLimbs] = {0};
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	std::uint64_t addend_shift = 0;
+	_kernelDecode(lhs, lhs_limbs, lhs_shift);
+	_kernelDecode(rhs, rhs_limbs, rhs_shift);
+	if (with_addend) {
+		_kernelDecode(addend, addend_limbs, addend_shift);
+	}
+	std::uint64_t wide_limbs[2 * kNumLimbs];
+	std::uint64_t low_limbs[kNumLimbs];
+	std::uint64_t high_limbs[kNumLimbs];
+	_limbsMulWide(lhs_limbs, rhs_limbs, addend_limbs, wide_limbs);
+	_limbsSplitWide(wide_limbs, low_limbs, high_limbs);
+	std::uint64_t shift = lhs_shift + rhs_shift + addend_shift;
+	if (low != nullptr) {
+		_kernelEncode(*low, low_limbs, shift);
+	}
+	if (high != nullptr) {
+		_kernelEncode(*high, high_limbs, shift);
+	}
+	return 0;
+}
+
+}
+
+constexpr uint239_wide_t MulWide(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(mul_wide);
+	uint239_wide_t result{};
+	bigint_impl::_mulWideInto(lhs, rhs, lhs, false, &result.low, &result.high);
+	return result;
+}
+
+constexpr uint239_t MulHigh(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(mul_high);
+	uint239_t result{};
+	bigint_impl::_mulWideInto(lhs, rhs, lhs, false, nullptr, &result);
+	return result;
+}
+
+constexpr uint239_wide_t MulAdd(const uint239_t& lhs, const uint239_t& rhs, const uint239_t& addend) {
+	BIGINT_STATS_SCOPE(mul_add);
+	uint239_wide_t result{};
+	bigint_impl::_mulWideInto(lhs, rhs, addend, true, &result.low, &result.high);
+	return result;
+}
+
+namespace bigint_impl {
+
+// lhs * rhs with overflow tracking for Pow. Once overflow is set only the low half is
+// needed; before that, operands of at most 239 bits together skip the wide product.
+constexpr bool _limbsMulChecked(const std::uint64_t lhs_limbs[kNumLimbs], const std::uint64_t rhs_limbs[kNumLimbs], std::uint64_t result_limbs[kNumLimbs], bool& overflow) {
+	if (overflow || _highestSetBit(lhs_limbs) + _highestSetBit(rhs_limbs) + 2 <= kSignificantBits) {
+		return _limbsMul(lhs_limbs, rhs_limbs, result_limbs);
+	}
+	std::uint64_t zero_limbs[kNumLimbs] = {0};
+	std::uint64_t wide_limbs[2 * kNumLimbs];
+	std::uint64_t high_limbs[kNumLimbs];
+	_limbsMulWide(lhs_limbs, rhs_limbs, zero_limbs, wide_limbs);
+	_limbsSplitWide(wide_limbs, result_limbs, high_limbs);
+	overflow = !_limbsIsZero(high_limbs);
+	return 0;
+}
+
+// Every intermediate of the left-to-right order divides the final power, so an
+// intermediate overflow means the power overflows too.
+constexpr bool _limbsPow(const std::uint64_t base_limbs[kNumLimbs], std::uint64_t exponent, std::uint64_t result_limbs[kNumLimbs], bool& overflow) {
+	overflow = false;
+	std::fill_n(result_limbs, kNumLimbs, 0ULL);
+	result_limbs[0] = 1;
+	if (exponent == 0) {
+		return 0;
+	}
+	if (_limbsIsZero(base_limbs) || _limbsIsOne(base_limbs)) {
+		std::copy_n(base_limbs, kNumLimbs, result_limbs);
+		return 0;
+	}
+	for (int bit = _highestSetBit64(exponent); bit >= 0; --bit) {
+		_limbsMulChecked(result_limbs, result_limbs, result_limbs, overflow);
+		if ((exponent >> bit) & 1) {
+			_limbsMulChecked(result_limbs, base_limbs, result_limbs, overflow);
+		}
+	}
+	return 0;
+}
+
+constexpr int _limbsTrailingZeros(const std::uint64_t limbs[kNumLimbs]) {
+	int i = 0;
+	while (limbs[i] == 0) {
+		++i;
+	}
+	return i * 64 + std::countr_zero(limbs[i]);
+}
+
+// Both operands odd, rhs may be even after the first step.
+constexpr std::uint64_t _gcdOdd64(std::uint64_t lhs, std::uint64_t rhs) {
+	while (rhs != 0) {
+		rhs >>= std::countr_zero(rhs);
+		if (lhs > rhs) {
+			std::swap(lhs, rhs);
+		}
+		rhs -= lhs;
+	}
+	return lhs;
+}
+
+// Stein's binary GCD: the common power of two is taken out once, then the smaller odd
+// value is subtracted from the larger. It drops to single words once both fit one.
+constexpr bool _limbsGcd(const std::uint64_t lhs_limbs[kNumLimbs], const std::uint64_t rhs_limbs[kNumLimbs], std::uint64_t result_limbs[kNumLimbs]) {
+	if (_limbsIsZero(lhs_limbs) || _limbsIsZero(rhs_limbs)) {
+		const std::uint64_t* other = _limbsIsZero(lhs_limbs) ? rhs_limbs : lhs_limbs;
+		std::copy_n(other, kNumLimbs, result_limbs);
+		return 0;
+	}
+	std::uint64_t lhs[kNumLimbs];
+	std::uint64_t rhs[kNumLimbs];
+	int lhs_zeros = _limbsTrailingZeros(lhs_limbs);
+	int rhs_zeros = _limbsTrailingZeros(rhs_limbs);
+	_wordsShiftRight(lhs_limbs, lhs_zeros, lhs);
+	_wordsShiftRight(rhs_limbs, rhs_zeros, rhs);
+	while (true) {
+		if (_limbsLess(rhs, lhs)) {
+			std::swap_ranges(lhs, lhs + kNumLimbs, rhs);
+		}
+		if (_limbsLength(rhs) <= 1) {
+			lhs[0] = _gcdOdd64(lhs[0], rhs[0] - lhs[0]);
+			break;
+		}
+		_limbsSub(rhs, lhs, rhs);
+		if (_limbsIsZero(rhs)) {
+			break;
+		}
+		_wordsShiftRight(rhs, _limbsTrailingZeros(rhs), rhs);
+	}
+	return _wordsShiftLeft(lhs, std::min(lhs_zeros, rhs_zeros), result_limbs);
+}
+
+// s(i - 1) += q s(i), then the pair moves one step along the sequence.
+constexpr bool _extGcdStep(const std::uint64_t quotient[kNumLimbs], std::uint64_t coefficient[2][kNumLimbs]) {
+	_limbsMulAcc(quotient, coefficient[1], coefficient[0]);
+	coefficient[0][kNumLimbs - 1] &= kTopLimbMask;
+	std::swap_ranges(coefficient[0], coefficient[0] + kNumLimbs, coefficient[1]);
+	return 0;
+}
+
+// Euclid's remainder sequence r(0) = lhs, r(1) = rhs. The coefficients alternate in sign,
+// s(i) as (-1)^i and t(i) as (-1)^(i + 1), so only their magnitudes are kept:
+// |s(i + 1)| = |s(i - 1)| + q(i) |s(i)|, and likewise for t.
+constexpr bool _limbsExtGcd(const std::uint64_t lhs_limbs[kNumLimbs], const std::uint64_t rhs_limbs[kNumLimbs], std::uint64_t gcd_limbs[kNumLimbs], std::uint64_t x_limbs[kNumLimbs], std::uint64_t y_limbs[kNumLimbs], bool& x_negative, bool& y_negative) {
+	std::uint64_t remainder[2][kNumLimbs];
+	std::uint64_t x[2][kNumLimbs] = {{1}, {0}};
+	std::uint64_t y[2][kNumLimbs] = {{0}, {1}};
+	std::copy_n(lhs_limbs, kNumLimbs, remainder[0]);
+	std::copy_n(rhs_limbs, kNumLimbs, remainder[1]);
+	int index = _limbsIsZero(rhs_limbs) ? 0 : 1;
+	while (index != 0) {
+		std::uint64_t quotient[kNumLimbs];
+		std::uint64_t next[kNumLimbs];
+		_limbsDivMod(remainder[0], remainder[1], quotient, next);
+		if (_limbsIsZero(next)) {
+			break;
+		}
+		std::copy_n(remainder[1], kNumLimbs, remainder[0]);
+		std::copy_n(next, kNumLimbs, remainder[1]);
+		_extGcdStep(quotient, x);
+		_extGcdStep(quotient, y);
+		++index;
+	}
+	int last = index == 0 ? 0 : 1;
+	std::copy_n(remainder[last], kNumLimbs, gcd_limbs);
+	std::copy_n(x[last], kNumLimbs, x_limbs);
+	std::copy_n(y[last], kNumLimbs, y_limbs);
+	x_negative = index % 2 == 1 && !_limbsIsZero(x_limbs);
+	y_negative = index % 2 == 0 && !_limbsIsZero(y_limbs);
+	return 0;
+}
+
+// Newton's iteration from 2^ceil(bits / 2), which is at least the root, decreases
+// monotonically to floor(sqrt(value)); all iterates stay near the root, far below 2^239.
+constexpr bool _limbsIsqrt(const std::uint64_t value_limbs[kNumLimbs], std::uint64_t result_limbs[kNumLimbs]) {
+	std::fill_n(result_limbs, kNumLimbs, 0ULL);
+	int top_bit = _highestSetBit(value_limbs);
+	if (top_bit < 0) {
+		return 0;
+	}
+	int root_bit = (top_bit + 2) / 2;
+	result_limbs[root_bit / 64] = 1ULL << (root_bit % 64);
+	while (true) {
+		std::uint64_t quotient[kNumLimbs];
+		std::uint64_t remainder[kNumLimbs];
+		std::uint64_t next[kNumLimbs];
+		_limbsDivMod(value_limbs, result_limbs, quotient, remainder);
+		_limbsAdd(result_limbs, quotient, next);
+		_wordsShiftRight(next, 1, next);
+		if (!_limbsLess(next, result_limbs)) {
+			return 0;
+		}
+		std::copy_n(next, kNumLimbs, result_limbs);
+	}
+}
+
+}
+
+constexpr uint239_t Pow(const uint239_t& base, std::uint64_t exponent, bool& overflow) {
+	BIGINT_STATS_SCOPE(pow);
+	std::uint64_t base_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t result_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t shift = 0;
+	bigint_impl::_kernelDecode(base, base_limbs, shift);
+	bigint_impl::_limbsPow(base_limbs, exponent, result_limbs, overflow);
+	uint239_t result{};
+	bigint_impl::_kernelEncode(result, result_limbs, shift * exponent);
+	return result;
+}
+
+constexpr uint239_t Pow(const uint239_t& base, std::uint64_t exponent) {
+	bool overflow = false;
+	return Pow(base, exponent, overflow);
+}
+
+constexpr uint239_t Gcd(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(gcd);
+	std::uint64_t lhs_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t rhs_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	bigint_impl::_kernelDecode(lhs, lhs_limbs, lhs_shift);
+	bigint_impl::_kernelDecode(rhs, rhs_limbs, rhs_shift);
+	bigint_impl::_limbsGcd(lhs_limbs, rhs_limbs, lhs_limbs);
+	uint239_t result{};
+	bigint_impl::_kernelEncode(result, lhs_limbs, 0);
+	return result;
+}
+
+constexpr uint239_ext_gcd_t ExtGcd(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(ext_gcd);
+	std::uint64_t lhs_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t rhs_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	bigint_impl::_kernelDecode(lhs, lhs_limbs, lhs_shift);
+	bigint_impl::_kernelDecode(rhs, rhs_limbs, rhs_shift);
+	std::uint64_t gcd_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t x_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t y_limbs[bigint_impl::kNumLimbs];
+	uint239_ext_gcd_t result{};
+	bigint_impl::_limbsExtGcd(lhs_limbs, rhs_limbs, gcd_limbs, x_limbs, y_limbs, result.x_negative, result.y_negative);
+	bigint_impl::_kernelEncode(result.gcd, gcd_limbs, 0);
+	bigint_impl::_kernelEncode(result.x, x_limbs, 0);
+	bigint_impl::_kernelEncode(result.y, y_limbs, 0);
+	return result;
+}
+
+constexpr uint239_t Lcm(const uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(lcm);
+	std::uint64_t lhs_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t rhs_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t lhs_shift = 0;
+	std::uint64_t rhs_shift = 0;
+	bigint_impl::_kernelDecode(lhs, lhs_limbs, lhs_shift);
+	bigint_impl::_kernelDecode(rhs, rhs_limbs, rhs_shift);
+	std::uint64_t result_limbs[bigint_impl::kNumLimbs] = {0};
+	if (!bigint_impl::_limbsIsZero(lhs_limbs) && !bigint_impl::_limbsIsZero(rhs_limbs)) {
+		std::uint64_t gcd_limbs[bigint_impl::kNumLimbs];
+		std::uint64_t remainder[bigint_impl::kNumLimbs];
+		bigint_impl::_limbsGcd(lhs_limbs, rhs_limbs, gcd_limbs);
+		bigint_impl::_limbsDivMod(lhs_limbs, gcd_limbs, lhs_limbs, remainder);
+		bigint_impl::_limbsMul(lhs_limbs, rhs_limbs, result_limbs);
+	}
+	uint239_t result{};
+	bigint_impl::_kernelEncode(result, result_limbs, 0);
+	return result;
+}
+
+constexpr uint239_t Isqrt(const uint239_t& value) {
+	BIGINT_STATS_SCOPE(isqrt);
+	std::uint64_t limbs[bigint_impl::kNumLimbs];
+	std::uint64_t shift = 0;
+	std::uint64_t root_limbs[bigint_impl::kNumLimbs];
+	bigint_impl::_kernelDecode(value, limbs, shift);
+	bigint_impl::_limbsIsqrt(limbs, root_limbs);
+	uint239_t result{};
+	bigint_impl::_kernelEncode(result, root_limbs, 0);
+	return result;
+}
+
+namespace bigint_impl {
+
+// Multiply-xorshift per limb and the MurmurHash3 finaliser at the end.
+constexpr std::uint64_t _hashLimbs(const std::uint64_t limbs[kNumLimbs]) {
+	std::uint64_t hash = 0x9E3779B97F4A7C15ULL;
+	for (int i = 0; i < kNumLimbs; ++i) {
+		hash = (hash ^ limbs[i]) * 0xBF58476D1CE4E5B9ULL;
+		hash ^= hash >> 31;
+	}
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+}
+
+constexpr std::size_t std::hash<uint239_t>::operator()(const uint239_t& value) const noexcept {
+	BIGINT_STATS_SCOPE(hash);
+	std::uint64_t limbs[bigint_impl::kNumLimbs];
+	std::uint64_t shift = 0;
+	bigint_impl::_kernelDecode(value, limbs, shift);
+	return static_cast<std::size_t>(bigint_impl::_hashLimbs(limbs));
+}
+
+// The in-place forms encode straight into lhs. Sums and differences are taken on the
+// stored payloads (_addStoredInPlace). An identity or absorbing rhs for the other
+// operators is recognised on its stored bits, and then only the shift of lhs changes;
+// its padding is cleared all the same, so that the bytes match the binary operator.
+constexpr void AddInPlace(uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(add_in_place);
+	bigint_impl::_kernelAddInPlace(lhs, rhs);
+}
+
+constexpr void SubInPlace(uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(sub_in_place);
+	bigint_impl::_kernelSubInPlace(lhs, rhs);
+}
+
+constexpr void MulInPlace(uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(mul_in_place);
+	std::uint64_t new_shift = bigint_impl::_loadShift(lhs) + bigint_impl::_loadShift(rhs);
+	if (bigint_impl::_storedIsOne(rhs)) {
+		bigint_impl::_reshiftCanonicalInPlace(lhs, new_shift);
+		return;
+	}
+	if (bigint_impl::_storedIsZero(rhs)) {
+		std::uint64_t zero_limbs[bigint_impl::kNumLimbs] = {0};
+		bigint_impl::_encodeInto(lhs, zero_limbs, new_shift);
+		return;
+	}
+	bigint_impl::_kernelMul(lhs, rhs, lhs);
+}
+
+constexpr void DivInPlace(uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(div_in_place);
+	if (bigint_impl::_storedIsOne(rhs)) {
+		bigint_impl::_reshiftCanonicalInPlace(lhs, bigint_impl::_loadShift(lhs) - bigint_impl::_loadShift(rhs));
+		return;
+	}
+	bigint_impl::_kernelDivMod(lhs, rhs, &lhs, nullptr);
+}
+
+constexpr void ModInPlace(uint239_t& lhs, const uint239_t& rhs) {
+	BIGINT_STATS_SCOPE(mod_in_place);
+	if (bigint_impl::_storedIsOne(rhs)) {
+		std::uint64_t zero_limbs[bigint_impl::kNumLimbs] = {0};
+		bigint_impl::_encodeInto(lhs, zero_limbs, bigint_impl::_loadShift(lhs) - bigint_impl::_loadShift(rhs));
+		return;
+	}
+	bigint_impl::_kernelDivMod(lhs, rhs, nullptr, &lhs);
+}
+
+constexpr void ShiftLeftInPlace(uint239_t& lhs, uint32_t shift) {
+	BIGINT_STATS_SCOPE(shift_left_in_place);
+	bigint_impl::_reshiftInPlace(lhs, bigint_impl::_loadShift(lhs) + static_cast<std::uint64_t>(shift));
+}
+
+constexpr void ShiftRightInPlace(uint239_t& lhs, uint32_t shift) {
+	BIGINT_STATS_SCOPE(shift_right_in_place);
+	std::uint64_t modulus = (1ULL << 35);
+	std::uint64_t shift_64 = static_cast<std::uint64_t>(shift) & bigint_impl::kShiftMask35;
+	bigint_impl::_reshiftInPlace(lhs, bigint_impl::_loadShift(lhs) + modulus - shift_64);
+}
+
+constexpr uint239_t& operator+=(uint239_t& lhs, const uint239_t& rhs) {
+	AddInPlace(lhs, rhs);
+	return lhs;
+}
+
+constexpr uint239_t& operator-=(uint239_t& lhs, const uint239_t& rhs) {
+	SubInPlace(lhs, rhs);
+	return lhs;
+}
+
+constexpr uint239_t& operator*=(uint239_t& lhs, const uint239_t& rhs) {
+	MulInPlace(lhs, rhs);
+	return lhs;
+}
+
+constexpr uint239_t& operator/=(uint239_t& lhs, const uint239_t& rhs) {
+	DivInPlace(lhs, rhs);
+	return lhs;
+}
+
+constexpr uint239_t& operator%=(uint239_t& lhs, const uint239_t& rhs) {
+	ModInPlace(lhs, rhs);
+	return lhs;
+}
+
+constexpr uint239_t& operator<<=(uint239_t& lhs, uint32_t shift) {
+	ShiftLeftInPlace(lhs, shift);
+	return lhs;
+}
+
+constexpr uint239_t& operator>>=(uint239_t& lhs, uint32_t shift) {
+	ShiftRightInPlace(lhs, shift);
+	return lhs;
+}
+
+constexpr uint239_work::uint239_work(const uint239_t& value) {
+	bigint_impl::_kernelDecode(value, limbs, shift);
+}
+
+constexpr uint239_t uint239_work::Pack() const {
+	uint239_t result{};
+	bigint_impl::_kernelEncode(result, limbs, shift);
+	return result;
+}
+
+constexpr uint32_t GetShift(const uint239_work& value) {
+	BIGINT_STATS_SCOPE(work_get_shift);
+	return static_cast<uint32_t>(value.shift);
+}
+
+// Limbs of a working value are always reduced below 2^239 and its shift below 2^35,
+// so the operators below never need to mask their inputs.
+constexpr uint239_work& operator+=(uint239_work& lhs, const uint239_work& rhs) {
+	BIGINT_STATS_SCOPE(work_add);
+	bigint_impl::_limbsAdd(lhs.limbs, rhs.limbs, lhs.limbs);
+	lhs.shift = (lhs.shift + rhs.shift) & bigint_impl::kShiftMask35;
+	return lhs;
+}
+
+constexpr uint239_work& operator-=(uint239_work& lhs, const uint239_work& rhs) {
+	BIGINT_STATS_SCOPE(work_sub);
+	bigint_impl::_limbsSub(lhs.limbs, rhs.limbs, lhs.limbs);
+	lhs.shift = (lhs.shift - rhs.shift) & bigint_impl::kShiftMask35;
+	return lhs;
+}
+
+constexpr uint239_work& operator*=(uint239_work& lhs, const uint239_work& rhs) {
+	BIGINT_STATS_SCOPE(work_mul);
+	bigint_impl::_limbsMul(lhs.limbs, rhs.limbs, lhs.limbs);
+	lhs.shift = (lhs.shift + rhs.shift) & bigint_impl::kShiftMask35;
+	return lhs;
+}
+
+constexpr uint239_work& operator/=(uint239_work& lhs, const uint239_work& rhs) {
+	BIGINT_STATS_SCOPE(work_div);
+	std::uint64_t quotient_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t remainder_limbs[bigint_impl::kNumLimbs];
+	bigint_impl::_limbsDivMod(lhs.limbs, rhs.limbs, quotient_limbs, remainder_limbs);
+	std::copy_n(quotient_limbs, bigint_impl::kNumLimbs, lhs.limbs);
+	lhs.shift = (lhs.shift - rhs.shift) & bigint_impl::kShiftMask35;
+	return lhs;
+}
+
+constexpr uint239_work& operator%=(uint239_work& lhs, const uint239_work& rhs) {
+	BIGINT_STATS_SCOPE(work_mod);
+	std::uint64_t quotient_limbs[bigint_impl::kNumLimbs];
+	std::uint64_t remainder_limbs[bigint_impl::kNumLimbs];
+	bigint_impl::_limbsDivMod(lhs.limbs, rhs.limbs, quotient_limbs, remainder_limbs);
+	std::copy_n(remainder_limbs, bigint_impl::kNumLimbs, lhs.limbs);
+	lhs.shift = (lhs.shift - rhs.shift) & bigint_impl::kShiftMask35;
+	return lhs;
+}
+
+constexpr uint239_work& operator<<=(uint239_work& lhs, uint32_t shift) {
+	BIGINT_STATS_SCOPE(work_shift_left);
+	lhs.shift = (lhs.shift + shift) & bigint_impl::kShiftMask35;
+	return lhs;
+}
+
+constexpr uint239_work& operator>>=(uint239_work& lhs, uint32_t shift) {
+	BIGINT_STATS_SCOPE(work_shift_right);
+	lhs.shift = (lhs.shift - shift) & bigint_impl::kShiftMask35;
+	return lhs;
+}
+
+constexpr uint239_work operator+(const uint239_work& lhs, const uint239_work& rhs) {
+	uint239_work result = lhs;
+	return result += rhs;
+}
+
+constexpr uint239_work operator-(const uint239_work& lhs, const uint239_work& rhs) {
+	uint239_work result = lhs;
+	return result -= rhs;
+}
+
+constexpr uint239_work operator*(const uint239_work& lhs, const uint239_work& rhs) {
+	uint239_work result = lhs;
+	return result *= rhs;
+}
+
+constexpr uint239_work operator/(const uint239_work& lhs, const uint239_work& rhs) {
+	uint239_work result = lhs;
+	return result /= rhs;
+}
+
+constexpr uint239_work operator%(const uint239_work& lhs, const uint239_work& rhs) {
+	uint239_work result = lhs;
+	return result %= rhs;
+}
+
+constexpr uint239_work operator<<(const uint239_work& lhs, uint32_t shift) {
+	uint239_work result = lhs;
+	return result <<= shift;
+}
+
+constexpr uint239_work operator>>(const uint239_work& lhs, uint32_t shift) {
+	uint239_work result = lhs;
+	return result >>= shift;
+}
+
+constexpr bool operator==(const uint239_work& lhs, const uint239_work& rhs) {
+	BIGINT_STATS_SCOPE(work_equal);
+	return bigint_impl::_limbsEqual(lhs.limbs, rhs.limbs);
+}
+
+constexpr bool operator!=(const uint239_work& lhs, const uint239_work& rhs) {
+	return !(lhs == rhs);
+}
+
+constexpr bool operator<(const uint239_work& lhs, const uint239_work& rhs) {
+	BIGINT_STATS_SCOPE(work_less);
+	return bigint_impl::_limbsLess(lhs.limbs, rhs.limbs);
+}
+
+constexpr bool operator>(const uint239_work& lhs, const uint239_work& rhs) {
+	return rhs < lhs;
+}
+
+consteval uint239_t operator""_u239(const char* literal) {
+	int base = 10;
+	const char* p = literal;
+	if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+		base = 16;
+		p += 2;
+	} else if (p[0] == '0' && (p[1] == 'b' || p[1] == 'B')) {
+		base = 2;
+		p += 2;
+	} else if (p[0] == '0' && p[1] != '\0') {
+		base = 8;
+		p += 1;
+	}
+	std::uint64_t limbs[bigint_impl::kNumLimbs] = {0};
+	for (; *p != '\0'; ++p) {
+		if (*p == '\'') continue;
+		int digit = bigint_impl::_digitValue(*p);
+		if (digit >= base) {
+			throw std::invalid_argument("uint239_t literal has an invalid digit");
+		}
+		if (bigint_impl::_limbsMulAddWord(limbs, static_cast<std::uint64_t>(base), static_cast<std::uint64_t>(digit))) {
+			throw std::out_of_range("uint239_t literal does not fit into 239 bits");
+		}
+	}
+	return bigint_impl::_encodeFromLimbs(limbs, 0);
+}
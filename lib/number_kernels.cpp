@@ -0,0 +1,530 @@
+// Compiled once per CPU tier (see lib/CMakeLists.txt) with BIGINT_KERNEL_TIER naming the
+// tier, BIGINT_KERNEL_NAMESPACE giving its helpers their own symbols and BIGINT_KERNEL_TARGET
+// its features. Only the helpers and the code below are built for the tier; the public
+// inline functions and the standard library stay generic, so only helpers may be called.
+#include "number.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(BIGINT_KERNEL_AVX2)
+#include <immintrin.h>
+#endif
+
+#define BIGINT_STRINGIFY_NAME(name) #name
+#define BIGINT_STRINGIFY(name) BIGINT_STRINGIFY_NAME(name)
+
+// Columns are processed in blocks of kBatchLanes values. A block is transposed into
+// structure-of-arrays form, one vector per 64-bit word with one value in every lane,
+// and the codec runs on whole vectors: the byte order of a chunk is one byte shuffle,
+// and group packing, the shift modulo 245 and the per-lane rotation only need lane-wise
+// shifts, masks and compares. The vectors are GCC/Clang vector extensions and compile
+// to AVX-512 or AVX2 instructions; other targets, and the tail of a column, go through
+// the scalar helpers.
+BIGINT_KERNEL_TARGET_BEGIN
+namespace bigint_impl {
+inline namespace BIGINT_KERNEL_NAMESPACE {
+
+#if defined(__GNUC__) && defined(BIGINT_KERNEL_AVX2)
+#define BIGINT_BATCH_VECTORS
+#endif
+
+#if defined(BIGINT_BATCH_VECTORS)
+
+#if defined(BIGINT_KERNEL_AVX512)
+constexpr int kBatchLanes = 8;
+#else
+constexpr int kBatchLanes = 4;
+#endif
+
+typedef std::uint64_t _laneVector __attribute__((vector_size(8 * kBatchLanes)));
+
+constexpr int kNumChunks = kNumFullChunks + 1;
+constexpr int kChunkBits = kGroupsPerChunk * 7;
+constexpr int kTailShift = 8 * (kGroupsPerChunk - kTailBytes);
+
+static_assert(kTailBytes != 0, "The tail chunk is loaded from the first eight bytes");
+
+template <class Vector>
+inline Vector _laneSplat(std::uint64_t value) {
+	return Vector{} + value;
+}
+
+template <class Vector>
+inline Vector _laneLess(Vector lhs, Vector rhs) {
+	return (Vector)(lhs < rhs);
+}
+
+template <class Vector>
+inline Vector _laneEqual(Vector lhs, Vector rhs) {
+	return (Vector)(lhs == rhs);
+}
+
+template <class Vector>
+inline Vector _lanePackGroups(Vector chunk) {
+	chunk &= kGroupMask;
+	chunk = (chunk & 0x007F007F007F007FULL) | ((chunk & 0x7F007F007F007F00ULL) >> 1);
+	chunk = (chunk & 0x00003FFF00003FFFULL) | ((chunk & 0x3FFF00003FFF0000ULL) >> 2);
+	chunk = (chunk & 0x000000000FFFFFFFULL) | ((chunk & 0x0FFFFFFF00000000ULL) >> 4);
+	return chunk;
+}
+
+template <class Vector>
+inline Vector _laneUnpackGroups(Vector groups) {
+	groups &= 0x00FFFFFFFFFFFFFFULL;
+	groups = (groups & 0x000000000FFFFFFFULL) | ((groups << 4) & 0x0FFFFFFF00000000ULL);
+	groups = (groups & 0x00003FFF00003FFFULL) | ((groups << 2) & 0x3FFF00003FFF0000ULL);
+	groups = (groups & 0x007F007F007F007FULL) | ((groups << 1) & 0x7F007F007F007F00ULL);
+	return groups;
+}
+
+template <class Vector>
+inline Vector _lanePackServiceBits(Vector chunk) {
+	chunk = (chunk >> 7) & 0x0101010101010101ULL;
+	chunk = (chunk | (chunk >> 7)) & 0x0003000300030003ULL;
+	chunk = (chunk | (chunk >> 14)) & 0x0000000F0000000FULL;
+	chunk = (chunk | (chunk >> 28)) & 0xFFULL;
+	return chunk;
+}
+
+template <class Vector>
+inline Vector _laneUnpackServiceBits(Vector bits) {
+	bits &= 0xFFULL;
+	bits = (bits | (bits << 28)) & 0x0000000F0000000FULL;
+	bits = (bits | (bits << 14)) & 0x0003000300030003ULL;
+	bits = (bits | (bits << 7)) & 0x0101010101010101ULL;
+	return bits << 7;
+}
+
+// 256^k mod kDataBits for the bytes of a 35-bit shift.
+constexpr std::uint64_t _byteResidue(int k) {
+	std::uint64_t residue = 1;
+	for (int i = 0; i < k; ++i) {
+		residue = residue * 256 % kDataBits;
+	}
+	return residue;
+}
+
+constexpr std::uint64_t _foldBound(std::uint64_t bound) {
+	return 255 + (bound >> 8) * _byteResidue(1);
+}
+
+// The shift modulo kDataBits without a division: the five bytes are folded with their
+// residues, the result is folded twice more byte by byte and corrected once.
+constexpr std::uint64_t kShiftFoldBound = 255 * (_byteResidue(0) + _byteResidue(1) + _byteResidue(2) + _byteResidue(3)) + 7 * _byteResidue(4);
+static_assert(_foldBound(_foldBound(kShiftFoldBound)) < 2 * kDataBits, "Two folds must leave one correction step");
+
+template <class Vector>
+inline Vector _laneModDataBits(Vector shift) {
+	Vector folded = (shift & 0xFF) + ((shift >> 8) & 0xFF) * _byteResidue(1) + ((shift >> 16) & 0xFF) * _byteResidue(2) +
+	                ((shift >> 24) & 0xFF) * _byteResidue(3) + (shift >> 32) * _byteResidue(4);
+	folded = (folded & 0xFF) + (folded >> 8) * _byteResidue(1);
+	folded = (folded & 0xFF) + (folded >> 8) * _byteResidue(1);
+	Vector limit = _laneSplat<Vector>(kDataBits);
+	return folded - (~_laneLess(folded, limit) & limit);
+}
+
+// lhs in the lanes of mask, rhs in the others; one vpternlogq on AVX-512.
+template <class Vector>
+inline Vector _laneSelect(Vector mask, Vector lhs, Vector rhs) {
+	return (lhs & mask) | (rhs & ~mask);
+}
+
+// Rotates the 245 stored bits right by count in [0, kDataBits]. Doubling the payload
+// to 490 bits turns the rotation into one right shift. Its word part is taken one bit
+// of count at a time, by two words and then by one, with lane selects; its bit part is
+// a variable lane shift.
+template <class Vector>
+inline void _laneRotateRight(Vector words[kNumDataWords], Vector count) {
+	constexpr int kWordOffset = kDataBits / 64;
+	constexpr int kBitOffset = kDataBits % 64;
+	static_assert(kBitOffset != 0 && kWordOffset + kNumDataWords <= 2 * kNumDataWords, "Unexpected payload width");
+	static_assert(kNumDataWords == 4, "The word part of the shift takes two steps");
+	Vector doubled[2 * kNumDataWords] = {};
+	for (int i = 0; i < kNumDataWords; ++i) {
+		doubled[i] |= words[i];
+		doubled[i + kWordOffset] |= words[i] << kBitOffset;
+		if (i + kWordOffset + 1 < 2 * kNumDataWords) {
+			doubled[i + kWordOffset + 1] |= words[i] >> (64 - kBitOffset);
+		}
+	}
+	Vector by_two = _laneEqual(count & 128, _laneSplat<Vector>(128));
+	Vector by_one = _laneEqual(count & 64, _laneSplat<Vector>(64));
+	Vector half[kNumDataWords + 2];
+	for (int i = 0; i < kNumDataWords + 2; ++i) {
+		half[i] = _laneSelect(by_two, doubled[i + 2], doubled[i]);
+	}
+	Vector picked[kNumDataWords + 1];
+	for (int i = 0; i <= kNumDataWords; ++i) {
+		picked[i] = _laneSelect(by_one, half[i + 1], half[i]);
+	}
+	Vector bit_shift = count & 63;
+	for (int i = 0; i < kNumDataWords; ++i) {
+		words[i] = (picked[i] >> bit_shift) | ((picked[i + 1] << 1) << (63 - bit_shift));
+	}
+	words[kNumDataWords - 1] &= kTopDataWordMask;
+}
+
+// Swaps the bytes of every 64-bit lane (vpshufb, whose indices count within 16 bytes).
+inline _laneVector _laneByteSwap(_laneVector words) {
+	_laneVector order;
+	for (int lane = 0; lane < kBatchLanes; ++lane) {
+		order[lane] = lane % 2 == 0 ? 0x0001020304050607ULL : 0x08090A0B0C0D0E0FULL;
+	}
+#if defined(BIGINT_KERNEL_AVX512)
+	return (_laneVector)_mm512_shuffle_epi8((__m512i)words, (__m512i)order);
+#else
+	return (_laneVector)_mm256_shuffle_epi8((__m256i)words, (__m256i)order);
+#endif
+}
+
+// Stores the chunk of every lane as eight big-endian bytes at offset in its value.
+inline void _laneStoreReversed64(uint239_t* values, int offset, _laneVector chunk) {
+	_laneVector words = _laneByteSwap(chunk);
+	for (int lane = 0; lane < kBatchLanes; ++lane) {
+		std::uint64_t word = words[lane];
+		std::memcpy(values[lane].data + offset, &word, sizeof(word));
+	}
+}
+
+// Decodes one block. The chunk words are copied into a column per chunk as they are
+// and byte-swapped one column vector at a time; everything after the copy works on
+// whole vectors.
+inline void _laneDecode(const uint239_t* values, _laneVector limbs[kNumLimbs], _laneVector& shift) {
+	alignas(sizeof(_laneVector)) std::uint64_t chunks[kNumChunks][kBatchLanes];
+	for (int lane = 0; lane < kBatchLanes; ++lane) {
+		const std::uint8_t* data = values[lane].data;
+		for (int chunk_index = 0; chunk_index < kNumFullChunks; ++chunk_index) {
+			std::memcpy(&chunks[chunk_index][lane], data + kNumBytes - (chunk_index + 1) * kGroupsPerChunk, sizeof(std::uint64_t));
+		}
+		std::memcpy(&chunks[kNumFullChunks][lane], data, sizeof(std::uint64_t));
+	}
+	shift = _laneVector{};
+	for (int i = 0; i < kNumLimbs; ++i) {
+		limbs[i] = _laneVector{};
+	}
+	for (int chunk_index = 0; chunk_index < kNumChunks; ++chunk_index) {
+		_laneVector chunk;
+		std::memcpy(&chunk, chunks[chunk_index], sizeof(chunk));
+		chunk = _laneByteSwap(chunk);
+		if (chunk_index == kNumFullChunks) {
+			chunk >>= kTailShift;
+		}
+		_laneVector groups = _lanePackGroups(chunk);
+		shift |= _lanePackServiceBits(chunk) << (chunk_index * kGroupsPerChunk);
+		int word_index = chunk_index * kChunkBits / 64;
+		int bit_index = chunk_index * kChunkBits % 64;
+		limbs[word_index] |= groups << bit_index;
+		if (bit_index != 0 && word_index + 1 < kNumDataWords) {
+			limbs[word_index + 1] |= groups >> (64 - bit_index);
+		}
+	}
+	shift &= kShiftMask35;
+	_laneRotateRight(limbs, _laneModDataBits(shift));
+	limbs[kNumLimbs - 1] &= kTopLimbMask;
+}
+
+// The tail chunk is stored first as a full word over bytes 0..7; the full chunks
+// written after it overwrite the bytes that do not belong to it.
+inline void _laneEncode(uint239_t* values, const _laneVector limbs[kNumLimbs], _laneVector shift) {
+	_laneVector stored[kNumDataWords];
+	for (int i = 0; i < kNumDataWords; ++i) {
+		stored[i] = limbs[i];
+	}
+	stored[kNumDataWords - 1] &= kTopLimbMask;
+	shift &= kShiftMask35;
+	_laneRotateRight(stored, _laneSplat<_laneVector>(kDataBits) - _laneModDataBits(shift));
+	for (int chunk_index = kNumChunks - 1; chunk_index >= 0; --chunk_index) {
+		int word_index = chunk_index * kChunkBits / 64;
+		int bit_index = chunk_index * kChunkBits % 64;
+		_laneVector groups = stored[word_index] >> bit_index;
+		if (bit_index != 0 && word_index + 1 < kNumDataWords) {
+			groups |= stored[word_index + 1] << (64 - bit_index);
+		}
+		_laneVector chunk = _laneUnpackGroups(groups) | _laneUnpackServiceBits(shift >> (chunk_index * kGroupsPerChunk));
+		if (chunk_index < kNumFullChunks) {
+			_laneStoreReversed64(values, kNumBytes - (chunk_index + 1) * kGroupsPerChunk, chunk);
+		} else {
+			_laneStoreReversed64(values, 0, chunk << kTailShift);
+		}
+	}
+}
+
+// Carries are kept as all-ones lane masks, so adding one is subtracting the mask.
+template <class Vector>
+inline void _laneAdd(const Vector lhs[kNumLimbs], const Vector rhs[kNumLimbs], Vector result[kNumLimbs]) {
+	Vector carry = Vector{};
+	for (int i = 0; i < kNumLimbs; ++i) {
+		Vector sum = lhs[i] + rhs[i];
+		Vector carry_out = _laneLess(sum, lhs[i]);
+		Vector total = sum - carry;
+		carry = carry_out | _laneLess(total, sum);
+		result[i] = total;
+	}
+	result[kNumLimbs - 1] &= kTopLimbMask;
+}
+
+template <class Vector>
+inline void _laneSub(const Vector lhs[kNumLimbs], const Vector rhs[kNumLimbs], Vector result[kNumLimbs]) {
+	Vector borrow = Vector{};
+	for (int i = 0; i < kNumLimbs; ++i) {
+		Vector diff = lhs[i] - rhs[i];
+		Vector borrow_out = _laneLess(lhs[i], rhs[i]);
+		Vector total = diff + borrow;
+		borrow = borrow_out | _laneLess(diff, total);
+		result[i] = total;
+	}
+	result[kNumLimbs - 1] &= kTopLimbMask;
+}
+
+// Vector units multiply 32 x 32 -> 64 bits per lane, so the operands are split into
+// 32-bit digits and the low 256 bits of the product are formed from the 36 digit
+// products below the diagonal. Each product adds its low half to its column and its high
+// half to the next one; no column sum reaches 2^36, and one carry pass at the end turns
+// the columns back into digits.
+// The low 32 bits of every lane times the low 32 bits of the same lane (vpmuludq). The
+// generic vector multiply would be a full 64-bit one, emulated or vpmullq. The zero-masked
+// form with every lane selected is the same instruction; the plain AVX-512 intrinsic
+// passes an undefined merge source that -Wmaybe-uninitialized reports.
+inline _laneVector _laneMulDigits(_laneVector lhs, _laneVector rhs) {
+#if defined(BIGINT_KERNEL_AVX512)
+	return (_laneVector)_mm512_maskz_mul_epu32(static_cast<__mmask8>(0xFF), (__m512i)lhs, (__m512i)rhs);
+#else
+	return (_laneVector)_mm256_mul_epu32((__m256i)lhs, (__m256i)rhs);
+#endif
+}
+
+template <class Vector>
+inline void _laneMul(const Vector lhs[kNumLimbs], const Vector rhs[kNumLimbs], Vector result[kNumLimbs]) {
+	constexpr int kDigits = 2 * kNumLimbs;
+	constexpr std::uint64_t kDigitMask = 0xFFFFFFFFULL;
+	Vector lhs_digits[kDigits];
+	Vector rhs_digits[kDigits];
+	for (int i = 0; i < kNumLimbs; ++i) {
+		lhs_digits[2 * i] = lhs[i] & kDigitMask;
+		lhs_digits[2 * i + 1] = lhs[i] >> 32;
+		rhs_digits[2 * i] = rhs[i] & kDigitMask;
+		rhs_digits[2 * i + 1] = rhs[i] >> 32;
+	}
+	Vector columns[kDigits] = {};
+#pragma GCC unroll 8
+	for (int i = 0; i < kDigits; ++i) {
+#pragma GCC unroll 8
+		for (int j = 0; i + j < kDigits; ++j) {
+			Vector product = _laneMulDigits(lhs_digits[i], rhs_digits[j]);
+			columns[i + j] += product & kDigitMask;
+			if (i + j + 1 < kDigits) {
+				columns[i + j + 1] += product >> 32;
+			}
+		}
+	}
+	Vector carry = Vector{};
+	for (int k = 0; k < kDigits; ++k) {
+		columns[k] += carry;
+		carry = columns[k] >> 32;
+		columns[k] &= kDigitMask;
+	}
+	for (int i = 0; i < kNumLimbs; ++i) {
+		result[i] = columns[2 * i] | (columns[2 * i + 1] << 32);
+	}
+	result[kNumLimbs - 1] &= kTopLimbMask;
+}
+
+template <class Vector>
+inline Vector _laneCompare(const Vector lhs[kNumLimbs], const Vector rhs[kNumLimbs]) {
+	Vector less = Vector{};
+	Vector greater = Vector{};
+	Vector decided = Vector{};
+	for (int i = kNumLimbs - 1; i >= 0; --i) {
+		less |= ~decided & _laneLess(lhs[i], rhs[i]);
+		greater |= ~decided & _laneLess(rhs[i], lhs[i]);
+		decided |= less | greater;
+	}
+	return (greater & 1) - (less & 1);
+}
+
+#endif
+
+void _decodeKernel(const uint239_t& value, std::uint64_t limbs[kNumLimbs], std::uint64_t& shift) {
+	_decodeToLimbs(value, limbs, shift);
+}
+
+void _encodeKernel(uint239_t& value, const std::uint64_t limbs[kNumLimbs], std::uint64_t shift) {
+	_encodeInto(value, limbs, shift);
+}
+
+void _addKernel(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	_addInto(lhs, rhs, result);
+}
+
+void _subKernel(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	_subInto(lhs, rhs, result);
+}
+
+void _mulKernel(const uint239_t& lhs, const uint239_t& rhs, uint239_t& result) {
+	_mulInto(lhs, rhs, result);
+}
+
+void _divModKernel(const uint239_t& lhs, const uint239_t& rhs, uint239_t* quotient, uint239_t* remainder) {
+	_divModInto(lhs, rhs, quotient, remainder);
+}
+
+void _addInPlaceKernel(uint239_t& lhs, const uint239_t& rhs) {
+	_addStoredInPlace<false>(lhs, rhs);
+}
+
+void _subInPlaceKernel(uint239_t& lhs, const uint239_t& rhs) {
+	_addStoredInPlace<true>(lhs, rhs);
+}
+
+void _addBatchKernel(const uint239_t* lhs, const uint239_t* rhs, uint239_t* result, std::size_t count) {
+	std::size_t index = 0;
+#if defined(BIGINT_BATCH_VECTORS)
+	for (; index + kBatchLanes <= count; index += kBatchLanes) {
+		_laneVector lhs_limbs[kNumLimbs];
+		_laneVector rhs_limbs[kNumLimbs];
+		_laneVector lhs_shift;
+		_laneVector rhs_shift;
+		_laneDecode(lhs + index, lhs_limbs, lhs_shift);
+		_laneDecode(rhs + index, rhs_limbs, rhs_shift);
+		_laneAdd(lhs_limbs, rhs_limbs, lhs_limbs);
+		_laneEncode(result + index, lhs_limbs, lhs_shift + rhs_shift);
+	}
+#endif
+	for (; index < count; ++index) {
+		_addInto(lhs[index], rhs[index], result[index]);
+	}
+}
+
+void _subBatchKernel(const uint239_t* lhs, const uint239_t* rhs, uint239_t* result, std::size_t count) {
+	std::size_t index = 0;
+#if defined(BIGINT_BATCH_VECTORS)
+	for (; index + kBatchLanes <= count; index += kBatchLanes) {
+		_laneVector lhs_limbs[kNumLimbs];
+		_laneVector rhs_limbs[kNumLimbs];
+		_laneVector lhs_shift;
+		_laneVector rhs_shift;
+		_laneDecode(lhs + index, lhs_limbs, lhs_shift);
+		_laneDecode(rhs + index, rhs_limbs, rhs_shift);
+		_laneSub(lhs_limbs, rhs_limbs, lhs_limbs);
+		_laneEncode(result + index, lhs_limbs, lhs_shift - rhs_shift);
+	}
+#endif
+	for (; index < count; ++index) {
+		_subInto(lhs[index], rhs[index], result[index]);
+	}
+}
+
+void _mulBatchKernel(const uint239_t* lhs, const uint239_t* rhs, uint239_t* result, std::size_t count) {
+	std::size_t index = 0;
+#if defined(BIGINT_BATCH_VECTORS)
+	for (; index + kBatchLanes <= count; index += kBatchLanes) {
+		_laneVector lhs_limbs[kNumLimbs];
+		_laneVector rhs_limbs[kNumLimbs];
+		_laneVector lhs_shift;
+		_laneVector rhs_shift;
+		_laneDecode(lhs + index, lhs_limbs, lhs_shift);
+		_laneDecode(rhs + index, rhs_limbs, rhs_shift);
+		_laneMul(lhs_limbs, rhs_limbs, lhs_limbs);
+		_laneEncode(result + index, lhs_limbs, lhs_shift + rhs_shift);
+	}
+#endif
+	for (; index < count; ++index) {
+		_mulInto(lhs[index], rhs[index], result[index]);
+	}
+}
+
+void _compareBatchKernel(const uint239_t* lhs, const uint239_t* rhs, int8_t* result, std::size_t count) {
+	std::size_t index = 0;
+#if defined(BIGINT_BATCH_VECTORS)
+	for (; index + kBatchLanes <= count; index += kBatchLanes) {
+		_laneVector lhs_limbs[kNumLimbs];
+		_laneVector rhs_limbs[kNumLimbs];
+		_laneVector lhs_shift;
+		_laneVector rhs_shift;
+		_laneDecode(lhs + index, lhs_limbs, lhs_shift);
+		_laneDecode(rhs + index, rhs_limbs, rhs_shift);
+		_laneVector order = _laneCompare(lhs_limbs, rhs_limbs);
+		for (int lane = 0; lane < kBatchLanes; ++lane) {
+			result[index + lane] = static_cast<int8_t>(order[lane]);
+		}
+	}
+#endif
+	for (; index < count; ++index) {
+		std::uint64_t lhs_limbs[kNumLimbs];
+		std::uint64_t rhs_limbs[kNumLimbs];
+		std::uint64_t lhs_shift = 0;
+		std::uint64_t rhs_shift = 0;
+		_decodeToLimbs(lhs[index], lhs_limbs, lhs_shift);
+		_decodeToLimbs(rhs[index], rhs_limbs, rhs_shift);
+		result[index] = static_cast<int8_t>(_limbsLess(rhs_limbs, lhs_limbs) - _limbsLess(lhs_limbs, rhs_limbs));
+	}
+}
+
+void _decodeBatchKernel(const uint239_t* values, uint239_work* result, std::size_t count) {
+	std::size_t index = 0;
+#if defined(BIGINT_BATCH_VECTORS)
+	for (; index + kBatchLanes <= count; index += kBatchLanes) {
+		_laneVector limbs[kNumLimbs];
+		_laneVector shift;
+		_laneDecode(values + index, limbs, shift);
+		for (int lane = 0; lane < kBatchLanes; ++lane) {
+			uint239_work& work = result[index + lane];
+			for (int i = 0; i < kNumLimbs; ++i) {
+				work.limbs[i] = limbs[i][lane];
+			}
+			work.shift = shift[lane];
+		}
+	}
+#endif
+	for (; index < count; ++index) {
+		_decodeToLimbs(values[index], result[index].limbs, result[index].shift);
+	}
+}
+
+void _encodeBatchKernel(const uint239_work* values, uint239_t* result, std::size_t count) {
+	std::size_t index = 0;
+#if defined(BIGINT_BATCH_VECTORS)
+	for (; index + kBatchLanes <= count; index += kBatchLanes) {
+		alignas(sizeof(_laneVector)) std::uint64_t columns[kNumLimbs + 1][kBatchLanes];
+		for (int lane = 0; lane < kBatchLanes; ++lane) {
+			const uint239_work& work = values[index + lane];
+			for (int i = 0; i < kNumLimbs; ++i) {
+				columns[i][lane] = work.limbs[i];
+			}
+			columns[kNumLimbs][lane] = work.shift;
+		}
+		_laneVector limbs[kNumLimbs];
+		_laneVector shift;
+		std::memcpy(limbs, columns, sizeof(limbs));
+		std::memcpy(&shift, columns[kNumLimbs], sizeof(shift));
+		_laneEncode(result + index, limbs, shift);
+	}
+#endif
+	for (; index < count; ++index) {
+		_encodeInto(result[index], values[index].limbs, values[index].shift);
+	}
+}
+
+extern const _kernelTable kKernels = {
+	BIGINT_STRINGIFY(BIGINT_KERNEL_TIER),
+	_decodeKernel,
+	_encodeKernel,
+	_addKernel,
+	_subKernel,
+	_mulKernel,
+	_divModKernel,
+	_addInPlaceKernel,
+	_subInPlaceKernel,
+	_addBatchKernel,
+	_subBatchKernel,
+	_mulBatchKernel,
+	_compareBatchKernel,
+	_decodeBatchKernel,
+	_encodeBatchKernel,
+};
+
+}
+}
+BIGINT_KERNEL_TARGET_END
@@ -0,0 +1,393 @@
+#include "number.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace bigint_impl;
+
+namespace {
+
+// Barrett and Montgomery run on the k = limb_count limbs the modulus takes, so a small
+// modulus costs proportionally less. A one-limb modulus reduces products with a single
+// 128-by-64 division instead of Barrett.
+constexpr int kModWideLimbs = 2 * kNumLimbs + 1;
+
+bool _modMulLimbs(const std::uint64_t* lhs_limbs, int lhs_length, const std::uint64_t* rhs_limbs, int rhs_length, std::uint64_t* result_limbs) {
+	std::fill_n(result_limbs, lhs_length + rhs_length, 0ULL);
+	for (int lhs_index = 0; lhs_index < lhs_length; ++lhs_index) {
+		std::uint64_t carry = 0;
+		for (int rhs_index = 0; rhs_index < rhs_length; ++rhs_index) {
+			result_limbs[lhs_index + rhs_index] = _mulAdd64(lhs_limbs[lhs_index], rhs_limbs[rhs_index], result_limbs[lhs_index + rhs_index], carry);
+		}
+		result_limbs[lhs_index + rhs_length] = carry;
+	}
+	return 0;
+}
+
+bool _modBelowModulus(const uint239_mod_context& context, const std::uint64_t* limbs, int length) {
+	for (int i = length - 1; i >= context.limb_count; --i) {
+		if (limbs[i] != 0) {
+			return false;
+		}
+	}
+	for (int i = context.limb_count - 1; i >= 0; --i) {
+		if (limbs[i] != context.modulus[i]) {
+			return limbs[i] < context.modulus[i];
+		}
+	}
+	return false;
+}
+
+bool _modSubModulus(const uint239_mod_context& context, std::uint64_t* limbs, int length) {
+	std::uint64_t borrow = 0;
+	for (int i = 0; i < length; ++i) {
+		limbs[i] = _subBorrow64(limbs[i], i < context.limb_count ? context.modulus[i] : 0, borrow);
+	}
+	return 0;
+}
+
+bool _modStore(const uint239_mod_context& context, const std::uint64_t* limbs, std::uint64_t result_limbs[kNumLimbs]) {
+	std::fill_n(result_limbs, kNumLimbs, 0ULL);
+	std::copy_n(limbs, context.limb_count, result_limbs);
+	return 0;
+}
+
+// HAC 14.42 with base 2^64: wide has 2k limbs, the remainder ends up below m after at
+// most two corrections.
+bool _modBarrett(const uint239_mod_context& context, const std::uint64_t* wide_limbs, std::uint64_t result_limbs[kNumLimbs]) {
+	int k = context.limb_count;
+	std::uint64_t estimate[2 * kNumLimbs + 3];
+	_modMulLimbs(wide_limbs + k - 1, k + 1, context.barrett_mu, k + 2, estimate);
+	std::uint64_t product[2 * kNumLimbs + 1];
+	_modMulLimbs(estimate + k + 1, k + 1, context.modulus, k, product);
+	std::uint64_t remainder[kNumLimbs + 1];
+	std::uint64_t borrow = 0;
+	for (int i = 0; i <= k; ++i) {
+		remainder[i] = _subBorrow64(wide_limbs[i], product[i], borrow);
+	}
+	while (!_modBelowModulus(context, remainder, k + 1)) {
+		_modSubModulus(context, remainder, k + 1);
+	}
+	return _modStore(context, remainder, result_limbs);
+}
+
+bool _modReduce(const uint239_mod_context& context, const std::uint64_t value_limbs[kNumLimbs], std::uint64_t result_limbs[kNumLimbs]) {
+	if (_modBelowModulus(context, value_limbs, kNumLimbs)) {
+		std::copy_n(value_limbs, kNumLimbs, result_limbs);
+		return 0;
+	}
+	if (context.limb_count == 1) {
+		std::uint64_t quotient[kNumLimbs];
+		std::uint64_t remainder = 0;
+		_limbsDivWord(value_limbs, context.modulus[0], quotient, remainder);
+		std::fill_n(result_limbs, kNumLimbs, 0ULL);
+		result_limbs[0] = remainder;
+		return 0;
+	}
+	std::uint64_t wide[2 * kNumLimbs] = {0};
+	std::copy_n(value_limbs, kNumLimbs, wide);
+	return _modBarrett(context, wide, result_limbs);
+}
+
+// Operands of the helpers below are already reduced; the result may alias either one.
+bool _modAdd(const uint239_mod_context& context, const std::uint64_t lhs_limbs[kNumLimbs], const std::uint64_t rhs_limbs[kNumLimbs], std::uint64_t result_limbs[kNumLimbs]) {
+	std::uint64_t sum[kNumLimbs + 1];
+	std::uint64_t carry = 0;
+	for (int i = 0; i < context.limb_count; ++i) {
+		sum[i] = _addCarry64(lhs_limbs[i], rhs_limbs[i], carry);
+	}
+	sum[context.limb_count] = carry;
+	if (!_modBelowModulus(context, sum, context.limb_count + 1)) {
+		_modSubModulus(context, sum, context.limb_count + 1);
+	}
+	return _modStore(context, sum, result_limbs);
+}
+
+bool _modSub(const uint239_mod_context& context, const std::uint64_t lhs_limbs[kNumLimbs], const std::uint64_t rhs_limbs[kNumLimbs], std::uint64_t result_limbs[kNumLimbs]) {
+	std::uint64_t diff[kNumLimbs];
+	std::uint64_t borrow = 0;
+	for (int i = 0; i < context.limb_count; ++i) {
+		diff[i] = _subBorrow64(lhs_limbs[i], rhs_limbs[i], borrow);
+	}
+	if (borrow) {
+		std::uint64_t carry = 0;
+		for (int i = 0; i < context.limb_count; ++i) {
+			diff[i] = _addCarry64(diff[i], context.modulus[i], carry);
+		}
+	}
+	return _modStore(context, diff, result_limbs);
+}
+
+bool _modMul(const uint239_mod_context& context, const std::uint64_t lhs_limbs[kNumLimbs], const std::uint64_t rhs_limbs[kNumLimbs], std::uint64_t result_limbs[kNumLimbs]) {
+	std::uint64_t wide[2 * kNumLimbs];
+	_modMulLimbs(lhs_limbs, context.limb_count, rhs_limbs, context.limb_count, wide);
+	if (context.limb_count == 1) {
+		std::uint64_t remainder = 0;
+		_divWide64(wide[1], wide[0], context.modulus[0], remainder);
+		std::fill_n(result_limbs, kNumLimbs, 0ULL);
+		result_limbs[0] = remainder;
+		return 0;
+	}
+	return _modBarrett(context, wide, result_limbs);
+}
+
+// Coarsely integrated operand scanning (Koc, Acar, Kaliski 1996): a R^-1 b mod m.
+bool _modMontgomeryMul(const uint239_mod_context& context, const std::uint64_t lhs_limbs[kNumLimbs], const std::uint64_t rhs_limbs[kNumLimbs], std::uint64_t result_limbs[kNumLimbs]) {
+	int k = context.limb_count;
+	std::uint64_t acc[kNumLimbs + 2] = {0};
+	for (int i = 0; i < k; ++i) {
+		std::uint64_t carry = 0;
+		for (int j = 0; j < k; ++j) {
+			acc[j] = _mulAdd64(lhs_limbs[j], rhs_limbs[i], acc[j], carry);
+		}
+		std::uint64_t overflow = 0;
+		acc[k] = _addCarry64(acc[k], carry, overflow);
+		acc[k + 1] = overflow;
+
+		std::uint64_t factor = acc[0] * context.montgomery_n_prime;
+		carry = 0;
+		_mulAdd64(factor, context.modulus[0], acc[0], carry);
+		for (int j = 1; j < k; ++j) {
+			acc[j - 1] = _mulAdd64(factor, context.modulus[j], acc[j], carry);
+		}
+		overflow = 0;
+		acc[k - 1] = _addCarry64(acc[k], carry, overflow);
+		acc[k] = acc[k + 1] + overflow;
+	}
+	if (!_modBelowModulus(context, acc, k + 1)) {
+		_modSubModulus(context, acc, k + 1);
+	}
+	return _modStore(context, acc, result_limbs);
+}
+
+bool _modRequireOdd(const uint239_mod_context& context) {
+	if ((context.modulus[0] & 1) == 0) {
+		throw std::invalid_argument("uint239_t Montgomery form needs an odd modulus");
+	}
+	return 0;
+}
+
+bool _exponentBit(const std::uint64_t exponent_limbs[kNumLimbs], int bit) {
+	return (exponent_limbs[bit / 64] >> (bit % 64)) & 1;
+}
+
+// Left-to-right sliding window over the odd powers base^1, base^3, ..., HAC 14.85.
+// one is the multiplicative identity in whatever form mul works on.
+bool _modPowWindow(const std::uint64_t base_limbs[kNumLimbs], const std::uint64_t exponent_limbs[kNumLimbs], const std::uint64_t one_limbs[kNumLimbs], auto mul, std::uint64_t result_limbs[kNumLimbs]) {
+	std::copy_n(one_limbs, kNumLimbs, result_limbs);
+	int length = _limbsLength(exponent_limbs);
+	if (length == 0) {
+		return 0;
+	}
+	int top_bit = (length - 1) * 64 + _highestSetBit64(exponent_limbs[length - 1]);
+	int window = top_bit >= 128 ? 5 : top_bit >= 32 ? 4 : top_bit >= 8 ? 3 : 1;
+
+	std::uint64_t powers[16][kNumLimbs];
+	std::copy_n(base_limbs, kNumLimbs, powers[0]);
+	if (window > 1) {
+		std::uint64_t square[kNumLimbs];
+		mul(base_limbs, base_limbs, square);
+		for (int i = 1; i < (1 << (window - 1)); ++i) {
+			mul(powers[i - 1], square, powers[i]);
+		}
+	}
+
+	bool started = false;
+	int bit = top_bit;
+	while (bit >= 0) {
+		if (!_exponentBit(exponent_limbs, bit)) {
+			mul(result_limbs, result_limbs, result_limbs);
+			--bit;
+			continue;
+		}
+		int low = std::max(bit - window + 1, 0);
+		while (!_exponentBit(exponent_limbs, low)) {
+			++low;
+		}
+		int digit = 0;
+		for (int i = bit; i >= low; --i) {
+			digit = (digit << 1) | static_cast<int>(_exponentBit(exponent_limbs, i));
+		}
+		if (started) {
+			for (int i = low; i <= bit; ++i) {
+				mul(result_limbs, result_limbs, result_limbs);
+			}
+			mul(result_limbs, powers[digit >> 1], result_limbs);
+		} else {
+			std::copy_n(powers[digit >> 1], kNumLimbs, result_limbs);
+			started = true;
+		}
+		bit = low - 1;
+	}
+	return 0;
+}
+
+uint239_t _modEncode(const std::uint64_t limbs[kNumLimbs]) {
+	uint239_t result{};
+	_kernelEncode(result, limbs, 0);
+	return result;
+}
+
+bool _modDecodeReduced(const uint239_mod_context& context, const uint239_t& value, std::uint64_t limbs[kNumLimbs]) {
+	std::uint64_t shift = 0;
+	_kernelDecode(value, limbs, shift);
+	return _modReduce(context, limbs, limbs);
+}
+
+}  // namespace
+
+uint239_mod_context::uint239_mod_context(const uint239_t& modulus_value) {
+	std::uint64_t shift = 0;
+	_kernelDecode(modulus_value, modulus, shift);
+	limb_count = _limbsLength(modulus);
+	if (limb_count == 0 || (limb_count == 1 && modulus[0] < 2)) {
+		throw std::invalid_argument("uint239_t modulus must be at least 2");
+	}
+
+	// One division gives both mu = floor(2^(128 k) / m) and 2^(128 k) mod m = R^2 mod m.
+	std::uint64_t dividend[kModWideLimbs] = {0};
+	std::uint64_t divisor[kModWideLimbs] = {0};
+	std::uint64_t quotient[kModWideLimbs];
+	std::uint64_t remainder[kModWideLimbs];
+	dividend[2 * limb_count] = 1;
+	std::copy_n(modulus, kNumLimbs, divisor);
+	_limbsDivMod<kModWideLimbs>(dividend, divisor, quotient, remainder);
+	std::copy_n(quotient, limb_count + 2, barrett_mu);
+	std::copy_n(remainder, kNumLimbs, montgomery_r2);
+
+	if (modulus[0] & 1) {
+		// Newton's iteration doubles the correct low bits of m^-1 each step: 3, 6, ..., 96.
+		std::uint64_t inverse = modulus[0];
+		for (int i = 0; i < 5; ++i) {
+			inverse *= 2 - modulus[0] * inverse;
+		}
+		montgomery_n_prime = 0 - inverse;
+	}
+}
+
+uint239_t uint239_mod_context::Modulus() const {
+	return _modEncode(modulus);
+}
+
+uint239_t uint239_mod_context::Reduce(const uint239_t& value) const {
+	BIGINT_STATS_SCOPE(mod_reduce);
+	std::uint64_t limbs[kNumLimbs];
+	_modDecodeReduced(*this, value, limbs);
+	return _modEncode(limbs);
+}
+
+uint239_t uint239_mod_context::AddMod(const uint239_t& lhs, const uint239_t& rhs) const {
+	BIGINT_STATS_SCOPE(mod_add);
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	_modDecodeReduced(*this, lhs, lhs_limbs);
+	_modDecodeReduced(*this, rhs, rhs_limbs);
+	_modAdd(*this, lhs_limbs, rhs_limbs, lhs_limbs);
+	return _modEncode(lhs_limbs);
+}
+
+uint239_t uint239_mod_context::SubMod(const uint239_t& lhs, const uint239_t& rhs) const {
+	BIGINT_STATS_SCOPE(mod_sub);
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	_modDecodeReduced(*this, lhs, lhs_limbs);
+	_modDecodeReduced(*this, rhs, rhs_limbs);
+	_modSub(*this, lhs_limbs, rhs_limbs, lhs_limbs);
+	return _modEncode(lhs_limbs);
+}
+
+uint239_t uint239_mod_context::MulMod(const uint239_t& lhs, const uint239_t& rhs) const {
+	BIGINT_STATS_SCOPE(mod_mul);
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	_modDecodeReduced(*this, lhs, lhs_limbs);
+	_modDecodeReduced(*this, rhs, rhs_limbs);
+	_modMul(*this, lhs_limbs, rhs_limbs, lhs_limbs);
+	return _modEncode(lhs_limbs);
+}
+
+uint239_t uint239_mod_context::PowMod(const uint239_t& base, const uint239_t& exponent) const {
+	BIGINT_STATS_SCOPE(mod_pow);
+	std::uint64_t base_limbs[kNumLimbs];
+	std::uint64_t exponent_limbs[kNumLimbs];
+	std::uint64_t shift = 0;
+	_modDecodeReduced(*this, base, base_limbs);
+	_kernelDecode(exponent, exponent_limbs, shift);
+	std::uint64_t one[kNumLimbs] = {1};
+	std::uint64_t result[kNumLimbs];
+	if ((modulus[0] & 1) == 0) {
+		_modPowWindow(base_limbs, exponent_limbs, one, [this](const std::uint64_t* lhs_limbs, const std::uint64_t* rhs_limbs, std::uint64_t* result_limbs) {
+			_modMul(*this, lhs_limbs, rhs_limbs, result_limbs);
+		}, result);
+		return _modEncode(result);
+	}
+	std::uint64_t montgomery_one[kNumLimbs];
+	_modMontgomeryMul(*this, one, montgomery_r2, montgomery_one);
+	_modMontgomeryMul(*this, base_limbs, montgomery_r2, base_limbs);
+	_modPowWindow(base_limbs, exponent_limbs, montgomery_one, [this](const std::uint64_t* lhs_limbs, const std::uint64_t* rhs_limbs, std::uint64_t* result_limbs) {
+		_modMontgomeryMul(*this, lhs_limbs, rhs_limbs, result_limbs);
+	}, result);
+	_modMontgomeryMul(*this, result, one, result);
+	return _modEncode(result);
+}
+
+// Extended Euclid keeping only the coefficient of value, itself reduced mod m:
+// coefficient * value = remainder (mod m) holds for both rows throughout.
+uint239_t uint239_mod_context::InvMod(const uint239_t& value) const {
+	BIGINT_STATS_SCOPE(mod_inv);
+	std::uint64_t previous[kNumLimbs];
+	std::uint64_t current[kNumLimbs];
+	std::uint64_t previous_coefficient[kNumLimbs] = {0};
+	std::uint64_t current_coefficient[kNumLimbs] = {1};
+	std::copy_n(modulus, kNumLimbs, previous);
+	_modDecodeReduced(*this, value, current);
+	while (_limbsLength(current) != 0) {
+		std::uint64_t quotient[kNumLimbs];
+		std::uint64_t remainder[kNumLimbs];
+		_limbsDivMod(previous, current, quotient, remainder);
+		std::copy_n(current, kNumLimbs, previous);
+		std::copy_n(remainder, kNumLimbs, current);
+
+		std::uint64_t next_coefficient[kNumLimbs];
+		_modReduce(*this, quotient, quotient);
+		_modMul(*this, quotient, current_coefficient, next_coefficient);
+		_modSub(*this, previous_coefficient, next_coefficient, next_coefficient);
+		std::copy_n(current_coefficient, kNumLimbs, previous_coefficient);
+		std::copy_n(next_coefficient, kNumLimbs, current_coefficient);
+	}
+	if (_limbsLength(previous) != 1 || previous[0] != 1) {
+		throw std::invalid_argument("uint239_t value is not invertible modulo the modulus");
+	}
+	return _modEncode(previous_coefficient);
+}
+
+uint239_t uint239_mod_context::ToMontgomery(const uint239_t& value) const {
+	BIGINT_STATS_SCOPE(to_montgomery);
+	_modRequireOdd(*this);
+	std::uint64_t limbs[kNumLimbs];
+	_modDecodeReduced(*this, value, limbs);
+	_modMontgomeryMul(*this, limbs, montgomery_r2, limbs);
+	return _modEncode(limbs);
+}
+
+uint239_t uint239_mod_context::FromMontgomery(const uint239_t& value) const {
+	BIGINT_STATS_SCOPE(from_montgomery);
+	_modRequireOdd(*this);
+	std::uint64_t limbs[kNumLimbs];
+	std::uint64_t one[kNumLimbs] = {1};
+	_modDecodeReduced(*this, value, limbs);
+	_modMontgomeryMul(*this, limbs, one, limbs);
+	return _modEncode(limbs);
+}
+
+uint239_t uint239_mod_context::MontgomeryMul(const uint239_t& lhs, const uint239_t& rhs) const {
+	BIGINT_STATS_SCOPE(montgomery_mul);
+	_modRequireOdd(*this);
+	std::uint64_t lhs_limbs[kNumLimbs];
+	std::uint64_t rhs_limbs[kNumLimbs];
+	_modDecodeReduced(*this, lhs, lhs_limbs);
+	_modDecodeReduced(*this, rhs, rhs_limbs);
+	_modMontgomeryMul(*this, lhs_limbs, rhs_limbs, lhs_limbs);
+	return _modEncode(lhs_limbs);
+}
@@ -0,0 +1,338 @@
+#include "number.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace bigint_impl;
+
+namespace {
+
+// Blocks have a fixed size and are combined in block order, which is what keeps the
+// column functions independent of the thread count.
+constexpr std::size_t kParallelBlockSize = 16384;
+
+std::atomic<unsigned> _threadCount{0};
+
+}  // namespace
+
+void SetThreadCount(unsigned threads) {
+	_threadCount.store(threads, std::memory_order_relaxed);
+}
+
+unsigned GetThreadCount() {
+	unsigned threads = _threadCount.load(std::memory_order_relaxed);
+	if (threads == 0) {
+		threads = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+	return threads;
+}
+
+namespace {
+
+// Workers are started on first use and sleep between jobs. A job hands out blocks from
+// one atomic counter, so a thread that finishes early takes over the remaining blocks.
+// One job runs at a time; the caller works on it too and waits for the workers it woke.
+struct _workerPool {
+	std::mutex run_mutex;
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable done;
+	std::vector<std::thread> workers;
+	std::uint64_t generation = 0;
+	std::size_t helpers = 0;
+	std::size_t pending = 0;
+	bool stopping = false;
+
+	std::size_t block_count = 0;
+	std::atomic<std::size_t> next_block{0};
+	void (*body)(void* context, std::size_t block) = nullptr;
+	void* context = nullptr;
+
+	~_workerPool() {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (std::thread& worker : workers) {
+			worker.join();
+		}
+	}
+};
+
+_workerPool& _threadPool() {
+	static _workerPool pool;
+	return pool;
+}
+
+bool _runBlocks(_workerPool& pool) {
+	for (std::size_t block = pool.next_block.fetch_add(1); block < pool.block_count; block = pool.next_block.fetch_add(1)) {
+		pool.body(pool.context, block);
+	}
+	return 0;
+}
+
+// seen is the generation at start-up, so a worker started for a job still picks it up.
+void _workerLoop(_workerPool& pool, std::size_t index, std::uint64_t seen) {
+	std::unique_lock<std::mutex> lock(pool.mutex);
+	while (true) {
+		pool.wake.wait(lock, [&] { return pool.stopping || pool.generation != seen; });
+		if (pool.stopping) {
+			return;
+		}
+		seen = pool.generation;
+		if (index >= pool.helpers) {
+			continue;
+		}
+		lock.unlock();
+		_runBlocks(pool);
+		lock.lock();
+		if (--pool.pending == 0) {
+			pool.done.notify_one();
+		}
+	}
+}
+
+}  // namespace
+
+void bigint_impl::_parallelRun(std::size_t block_count, void (*body)(void* context, std::size_t block), void* context) {
+	std::size_t helpers = std::min<std::size_t>(GetThreadCount(), block_count);
+	helpers = helpers == 0 ? 0 : helpers - 1;
+	if (helpers == 0) {
+		for (std::size_t block = 0; block < block_count; ++block) {
+			body(context, block);
+		}
+		return;
+	}
+
+	_workerPool& pool = _threadPool();
+	std::lock_guard<std::mutex> run_lock(pool.run_mutex);
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		while (pool.workers.size() < helpers) {
+			pool.workers.emplace_back(_workerLoop, std::ref(pool), pool.workers.size(), pool.generation);
+		}
+		pool.block_count = block_count;
+		pool.next_block.store(0);
+		pool.body = body;
+		pool.context = context;
+		pool.helpers = helpers;
+		pool.pending = helpers;
+		++pool.generation;
+	}
+	pool.wake.notify_all();
+	_runBlocks(pool);
+	std::unique_lock<std::mutex> lock(pool.mutex);
+	pool.done.wait(lock, [&] { return pool.pending == 0; });
+}
+
+namespace {
+
+std::size_t _blockCount(std::size_t size) {
+	return (size + kParallelBlockSize - 1) / kParallelBlockSize;
+}
+
+std::span<const uint239_t> _block(std::span<const uint239_t> values, std::size_t block) {
+	std::size_t first = block * kParallelBlockSize;
+	return values.subspan(first, std::min(kParallelBlockSize, values.size() - first));
+}
+
+// Decoded partial result of a block. Sums run modulo 2^256 with the top limb unmasked,
+// which is harmless because 2^239 divides 2^256; the final encode masks it.
+struct _sumAccumulator {
+	std::uint64_t limbs[kNumLimbs] = {0};
+	std::uint64_t shift = 0;
+};
+
+bool _accumulateAdd(_sumAccumulator& acc, const std::uint64_t limbs[kNumLimbs], std::uint64_t shift) {
+	std::uint64_t carry = 0;
+	for (int i = 0; i < kNumLimbs; ++i) {
+		acc.limbs[i] = _addCarry64(acc.limbs[i], limbs[i], carry);
+	}
+	acc.shift += shift;
+	return 0;
+}
+
+uint239_t _encodeAccumulator(_sumAccumulator& acc) {
+	acc.limbs[kNumLimbs - 1] &= kTopLimbMask;
+	uint239_t result{};
+	_kernelEncode(result, acc.limbs, acc.shift);
+	return result;
+}
+
+_sumAccumulator _sumBlock(std::span<const uint239_t> values) {
+	_sumAccumulator acc;
+	for (const uint239_t& value : values) {
+		std::uint64_t limbs[kNumLimbs];
+		std::uint64_t shift = 0;
+		_kernelDecode(value, limbs, shift);
+		_accumulateAdd(acc, limbs, shift);
+	}
+	return acc;
+}
+
+std::vector<_sumAccumulator> _blockSums(std::span<const uint239_t> values) {
+	std::vector<_sumAccumulator> partial(_blockCount(values.size()));
+	auto body = [&](std::size_t block) { partial[block] = _sumBlock(_block(values, block)); };
+	_parallelFor(partial.size(), body);
+	return partial;
+}
+
+}  // namespace
+
+uint239_t Sum(std::span<const uint239_t> values) {
+	BIGINT_STATS_SCOPE(sum);
+	_sumAccumulator total;
+	for (const _sumAccumulator& partial : _blockSums(values)) {
+		_accumulateAdd(total, partial.limbs, partial.shift);
+	}
+	return _encodeAccumulator(total);
+}
+
+uint239_t Product(std::span<const uint239_t> values) {
+	BIGINT_STATS_SCOPE(product);
+	std::vector<_sumAccumulator> partial(_blockCount(values.size()));
+	auto body = [&](std::size_t block) {
+		_sumAccumulator& acc = partial[block];
+		acc.limbs[0] = 1;
+		for (const uint239_t& value : _block(values, block)) {
+			std::uint64_t limbs[kNumLimbs];
+			std::uint64_t shift = 0;
+			_kernelDecode(value, limbs, shift);
+			_limbsMul(acc.limbs, limbs, acc.limbs);
+			acc.shift += shift;
+		}
+	};
+	_parallelFor(partial.size(), body);
+	_sumAccumulator total;
+	total.limbs[0] = 1;
+	for (const _sumAccumulator& block : partial) {
+		_limbsMul(total.limbs, block.limbs, total.limbs);
+		total.shift += block.shift;
+	}
+	return _encodeAccumulator(total);
+}
+
+uint239_t DotProduct(std::span<const uint239_t> lhs, std::span<const uint239_t> rhs) {
+	BIGINT_STATS_SCOPE(dot_product);
+	if (lhs.size() != rhs.size()) {
+		throw std::invalid_argument("uint239_t batch size mismatch");
+	}
+	std::vector<_sumAccumulator> partial(_blockCount(lhs.size()));
+	auto body = [&](std::size_t block) {
+		_sumAccumulator& acc = partial[block];
+		std::span<const uint239_t> lhs_block = _block(lhs, block);
+		std::span<const uint239_t> rhs_block = _block(rhs, block);
+		for (std::size_t i = 0; i < lhs_block.size(); ++i) {
+			std::uint64_t lhs_limbs[kNumLimbs];
+			std::uint64_t rhs_limbs[kNumLimbs];
+			std::uint64_t lhs_shift = 0;
+			std::uint64_t rhs_shift = 0;
+			_kernelDecode(lhs_block[i], lhs_limbs, lhs_shift);
+			_kernelDecode(rhs_block[i], rhs_limbs, rhs_shift);
+			_limbsMulAcc(lhs_limbs, rhs_limbs, acc.limbs);
+			acc.shift += lhs_shift + rhs_shift;
+		}
+	};
+	_parallelFor(partial.size(), body);
+	_sumAccumulator total;
+	for (const _sumAccumulator& block : partial) {
+		_accumulateAdd(total, block.limbs, block.shift);
+	}
+	return _encodeAccumulator(total);
+}
+
+namespace {
+
+// Index of the first element that no later one beats; ties keep the earlier index.
+struct _extremeEntry {
+	std::uint64_t limbs[kNumLimbs] = {0};
+	std::size_t index = 0;
+};
+
+template <bool kLargest>
+bool _better(const std::uint64_t candidate[kNumLimbs], const std::uint64_t best[kNumLimbs]) {
+	return kLargest ? _limbsLess(best, candidate) : _limbsLess(candidate, best);
+}
+
+template <bool kLargest>
+uint239_t _extreme(std::span<const uint239_t> values) {
+	if (values.empty()) {
+		throw std::invalid_argument("uint239_t reduction over an empty range");
+	}
+	std::vector<_extremeEntry> partial(_blockCount(values.size()));
+	auto body = [&](std::size_t block) {
+		_extremeEntry& best = partial[block];
+		std::size_t first = block * kParallelBlockSize;
+		std::span<const uint239_t> block_values = _block(values, block);
+		std::uint64_t shift = 0;
+		_kernelDecode(block_values[0], best.limbs, shift);
+		best.index = first;
+		for (std::size_t i = 1; i < block_values.size(); ++i) {
+			std::uint64_t limbs[kNumLimbs];
+			_kernelDecode(block_values[i], limbs, shift);
+			if (_better<kLargest>(limbs, best.limbs)) {
+				std::copy_n(limbs, kNumLimbs, best.limbs);
+				best.index = first + i;
+			}
+		}
+	};
+	_parallelFor(partial.size(), body);
+	const _extremeEntry* best = &partial[0];
+	for (const _extremeEntry& block : partial) {
+		if (_better<kLargest>(block.limbs, best->limbs)) {
+			best = &block;
+		}
+	}
+	return values[best->index];
+}
+
+}  // namespace
+
+uint239_t Min(std::span<const uint239_t> values) {
+	BIGINT_STATS_SCOPE(min);
+	return _extreme<false>(values);
+}
+
+uint239_t Max(std::span<const uint239_t> values) {
+	BIGINT_STATS_SCOPE(max);
+	return _extreme<true>(values);
+}
+
+// Two passes: block sums, then each block rescanned from the sum of the blocks before it.
+void PrefixSum(std::span<const uint239_t> values, std::span<uint239_t> result) {
+	BIGINT_STATS_SCOPE(prefix_sum);
+	if (values.size() != result.size()) {
+		throw std::invalid_argument("uint239_t batch size mismatch");
+	}
+	std::vector<_sumAccumulator> offsets = _blockSums(values);
+	_sumAccumulator running;
+	for (_sumAccumulator& offset : offsets) {
+		_sumAccumulator block_sum = offset;
+		offset = running;
+		_accumulateAdd(running, block_sum.limbs, block_sum.shift);
+	}
+	auto body = [&](std::size_t block) {
+		_sumAccumulator acc = offsets[block];
+		std::size_t first = block * kParallelBlockSize;
+		std::size_t count = _block(values, block).size();
+		for (std::size_t i = first; i < first + count; ++i) {
+			std::uint64_t limbs[kNumLimbs];
+			std::uint64_t shift = 0;
+			_kernelDecode(values[i], limbs, shift);
+			_accumulateAdd(acc, limbs, shift);
+			acc.limbs[kNumLimbs - 1] &= kTopLimbMask;
+			_kernelEncode(result[i], acc.limbs, acc.shift);
+		}
+	};
+	_parallelFor(offsets.size(), body);
+}
@@ -0,0 +1,134 @@
+#include "number.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using namespace bigint_impl;
+
+namespace {
+
+// Columns shorter than this are sorted by comparison; radix passes do not pay off there.
+constexpr std::size_t kRadixSortMin = 256;
+constexpr std::size_t kSortBlockSize = 16384;
+constexpr int kSortKeyBytes = (kSignificantBits + 7) / 8;
+
+// The decoded value and where its record sits in the input.
+struct _sortRecord {
+	std::uint64_t limbs[kNumLimbs];
+	std::size_t index;
+};
+
+using _digitCounts = std::array<std::size_t, 256>;
+
+constexpr std::uint8_t _sortDigit(const _sortRecord& record, int byte) {
+	return static_cast<std::uint8_t>(record.limbs[byte / 8] >> (byte % 8 * 8));
+}
+
+std::size_t _sortBlockCount(std::size_t size) {
+	return (size + kSortBlockSize - 1) / kSortBlockSize;
+}
+
+// Decodes every value once. Returns the bits that differ from the first value anywhere
+// in the column, so passes over bytes that are the same throughout can be skipped.
+bool _extractRecords(std::span<const uint239_t> values, std::vector<_sortRecord>& records, std::uint64_t varying[kNumLimbs]) {
+	std::uint64_t base[kNumLimbs];
+	std::uint64_t base_shift = 0;
+	_kernelDecode(values[0], base, base_shift);
+	std::vector<std::array<std::uint64_t, kNumLimbs>> partial(_sortBlockCount(values.size()));
+	auto body = [&](std::size_t block) {
+		std::size_t first = block * kSortBlockSize;
+		std::size_t last = std::min(first + kSortBlockSize, values.size());
+		std::array<std::uint64_t, kNumLimbs> diff = {};
+		for (std::size_t i = first; i < last; ++i) {
+			std::uint64_t shift = 0;
+			_kernelDecode(values[i], records[i].limbs, shift);
+			records[i].index = i;
+			for (int j = 0; j < kNumLimbs; ++j) {
+				diff[j] |= records[i].limbs[j] ^ base[j];
+			}
+		}
+		partial[block] = diff;
+	};
+	_parallelFor(partial.size(), body);
+	std::fill_n(varying, kNumLimbs, 0);
+	for (const std::array<std::uint64_t, kNumLimbs>& diff : partial) {
+		for (int j = 0; j < kNumLimbs; ++j) {
+			varying[j] |= diff[j];
+		}
+	}
+	return 0;
+}
+
+// One stable counting pass on the given byte: each block counts its digits, the counts
+// become per-block starting offsets in digit-major order, and each block scatters its
+// records from those offsets.
+bool _radixPass(const std::vector<_sortRecord>& from, std::vector<_sortRecord>& to, int byte) {
+	std::vector<_digitCounts> offsets(_sortBlockCount(from.size()));
+	auto count = [&](std::size_t block) {
+		_digitCounts& counts = offsets[block];
+		counts.fill(0);
+		std::size_t first = block * kSortBlockSize;
+		std::size_t last = std::min(first + kSortBlockSize, from.size());
+		for (std::size_t i = first; i < last; ++i) {
+			++counts[_sortDigit(from[i], byte)];
+		}
+	};
+	_parallelFor(offsets.size(), count);
+	std::size_t total = 0;
+	for (std::size_t digit = 0; digit < 256; ++digit) {
+		for (_digitCounts& counts : offsets) {
+			std::size_t block_count = counts[digit];
+			counts[digit] = total;
+			total += block_count;
+		}
+	}
+	auto scatter = [&](std::size_t block) {
+		_digitCounts& next = offsets[block];
+		std::size_t first = block * kSortBlockSize;
+		std::size_t last = std::min(first + kSortBlockSize, from.size());
+		for (std::size_t i = first; i < last; ++i) {
+			to[next[_sortDigit(from[i], byte)]++] = from[i];
+		}
+	};
+	_parallelFor(offsets.size(), scatter);
+	return 0;
+}
+
+}  // namespace
+
+void Sort(std::span<uint239_t> values) {
+	BIGINT_STATS_SCOPE(sort);
+	if (values.size() < 2) {
+		return;
+	}
+	std::vector<_sortRecord> records(values.size());
+	std::uint64_t varying[kNumLimbs];
+	_extractRecords(values, records, varying);
+	if (values.size() < kRadixSortMin) {
+		std::stable_sort(records.begin(), records.end(), [](const _sortRecord& lhs, const _sortRecord& rhs) { return _limbsLess(lhs.limbs, rhs.limbs); });
+	} else {
+		std::vector<_sortRecord> buffer(values.size());
+		for (int byte = 0; byte < kSortKeyBytes; ++byte) {
+			if (((varying[byte / 8] >> (byte % 8 * 8)) & 0xFF) == 0) {
+				continue;
+			}
+			_radixPass(records, buffer, byte);
+			records.swap(buffer);
+		}
+	}
+
+	std::vector<uint239_t> sorted(values.size());
+	auto gather = [&](std::size_t block) {
+		std::size_t first = block * kSortBlockSize;
+		std::size_t last = std::min(first + kSortBlockSize, values.size());
+		for (std::size_t i = first; i < last; ++i) {
+			sorted[i] = values[records[i].index];
+		}
+	};
+	_parallelFor(_sortBlockCount(values.size()), gather);
+	std::copy(sorted.begin(), sorted.end(), values.begin());
+}
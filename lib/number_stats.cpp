@@ -0,0 +1,241 @@
+#include "number.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(BIGINT_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#define BIGINT_STATS_RDTSC
+#endif
+
+#define BIGINT_STATS_NAME(name) #name,
+
+constexpr const char* kOpNames[kStatsOpCount] = {BIGINT_STATS_OPS(BIGINT_STATS_NAME)};
+
+#undef BIGINT_STATS_NAME
+
+#if defined(BIGINT_STATS_RDTSC)
+constexpr const char* kStatsClock = "cycles";
+#else
+constexpr const char* kStatsClock = "ns";
+#endif
+
+const char* GetOpName(uint239_op op) {
+	return kOpNames[static_cast<int>(op)];
+}
+
+#if defined(BIGINT_INSTRUMENTATION)
+namespace {
+
+constexpr std::uint64_t kStatsSampleEvery = 16;
+
+// Only the owning thread writes its counters, with a plain load and store instead of a
+// locked increment; snapshots read them from other threads, so they are still atomics.
+struct _opCounters {
+	std::atomic<std::uint64_t> calls{0};
+	std::atomic<std::uint64_t> samples{0};
+	std::atomic<std::uint64_t> sampled_ticks{0};
+	std::atomic<std::uint64_t> histogram[kStatsBuckets] = {};
+};
+
+struct _threadCounters {
+	_opCounters ops[kStatsOpCount];
+};
+
+// Counters only grow: exited threads are folded into retired, and ResetStats() records
+// the current totals as a baseline that later snapshots subtract.
+struct _statsState {
+	std::mutex mutex;
+	std::vector<const _threadCounters*> live;
+	uint239_stats retired;
+	uint239_stats baseline;
+};
+
+_statsState& _statsRegistry() {
+	static _statsState registry;
+	return registry;
+}
+
+bool _readThreadStats(const _threadCounters& thread, uint239_stats& total) {
+	for (int op = 0; op < kStatsOpCount; ++op) {
+		const _opCounters& from = thread.ops[op];
+		uint239_op_stats& to = total.ops[op];
+		to.calls += from.calls.load(std::memory_order_relaxed);
+		to.samples += from.samples.load(std::memory_order_relaxed);
+		to.sampled_ticks += from.sampled_ticks.load(std::memory_order_relaxed);
+		for (int bucket = 0; bucket < kStatsBuckets; ++bucket) {
+			to.histogram[bucket] += from.histogram[bucket].load(std::memory_order_relaxed);
+		}
+	}
+	return 0;
+}
+
+struct _threadCountersSlot {
+	_threadCounters stats;
+
+	_threadCountersSlot() {
+		_statsState& registry = _statsRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.live.push_back(&stats);
+	}
+
+	~_threadCountersSlot() {
+		_statsState& registry = _statsRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		_readThreadStats(stats, registry.retired);
+		registry.live.erase(std::find(registry.live.begin(), registry.live.end(), &stats));
+	}
+};
+
+thread_local _threadCountersSlot _threadStats;
+
+std::uint64_t _statsTicks() {
+#if defined(BIGINT_STATS_RDTSC)
+	return __rdtsc();
+#else
+	auto now = std::chrono::steady_clock::now().time_since_epoch();
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+#endif
+}
+
+bool _bump(std::atomic<std::uint64_t>& counter, std::uint64_t amount) {
+	counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	return 0;
+}
+
+}  // namespace
+
+bool _statsEnter(uint239_op op, std::uint64_t& start) {
+	_opCounters& counters = _threadStats.stats.ops[static_cast<int>(op)];
+	std::uint64_t calls = counters.calls.load(std::memory_order_relaxed);
+	_bump(counters.calls, 1);
+	if (calls % kStatsSampleEvery != 0) {
+		return false;
+	}
+	start = _statsTicks();
+	return true;
+}
+
+void _statsLeave(uint239_op op, std::uint64_t start) {
+	std::uint64_t ticks = _statsTicks() - start;
+	_opCounters& counters = _threadStats.stats.ops[static_cast<int>(op)];
+	int bucket = ticks == 0 ? 0 : std::min(static_cast<int>(std::bit_width(ticks)) - 1, kStatsBuckets - 1);
+	_bump(counters.samples, 1);
+	_bump(counters.sampled_ticks, ticks);
+	_bump(counters.histogram[bucket], 1);
+}
+
+namespace {
+
+bool _subtractStats(uint239_stats& total, const uint239_stats& baseline) {
+	for (int op = 0; op < kStatsOpCount; ++op) {
+		uint239_op_stats& to = total.ops[op];
+		const uint239_op_stats& from = baseline.ops[op];
+		to.calls -= from.calls;
+		to.samples -= from.samples;
+		to.sampled_ticks -= from.sampled_ticks;
+		for (int bucket = 0; bucket < kStatsBuckets; ++bucket) {
+			to.histogram[bucket] -= from.histogram[bucket];
+		}
+	}
+	return 0;
+}
+
+uint239_stats _statsTotals(_statsState& registry) {
+	uint239_stats total = registry.retired;
+	for (const _threadCounters* thread : registry.live) {
+		_readThreadStats(*thread, total);
+	}
+	return total;
+}
+
+}  // namespace
+
+uint239_stats SnapshotStats() {
+	_statsState& registry = _statsRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	uint239_stats stats = _statsTotals(registry);
+	_subtractStats(stats, registry.baseline);
+	stats.clock = kStatsClock;
+	return stats;
+}
+
+void ResetStats() {
+	_statsState& registry = _statsRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.baseline = _statsTotals(registry);
+}
+#else
+uint239_stats SnapshotStats() {
+	uint239_stats stats;
+	stats.clock = kStatsClock;
+	return stats;
+}
+
+void ResetStats() {
+}
+#endif
+
+namespace {
+
+bool _appendFormat(std::string& out, const char* format, auto... args) {
+	char buffer[128];
+	int length = std::snprintf(buffer, sizeof(buffer), format, args...);
+	out.append(buffer, static_cast<std::size_t>(std::min(length, static_cast<int>(sizeof(buffer)) - 1)));
+	return 0;
+}
+
+double _meanTicks(const uint239_op_stats& op) {
+	return op.samples == 0 ? 0.0 : static_cast<double>(op.sampled_ticks) / static_cast<double>(op.samples);
+}
+
+}  // namespace
+
+std::string StatsToText(const uint239_stats& stats) {
+	std::string out;
+	_appendFormat(out, "%-22s %14s %10s %12s\n", "operation", "calls", "samples", "mean");
+	for (int op = 0; op < kStatsOpCount; ++op) {
+		const uint239_op_stats& entry = stats.ops[op];
+		if (entry.calls == 0) {
+			continue;
+		}
+		_appendFormat(out, "%-22s %14llu %10llu %9.1f %s\n", kOpNames[op], static_cast<unsigned long long>(entry.calls),
+		              static_cast<unsigned long long>(entry.samples), _meanTicks(entry), stats.clock);
+		if (entry.samples == 0) {
+			continue;
+		}
+		out += "  ";
+		for (int bucket = 0; bucket < kStatsBuckets; ++bucket) {
+			if (entry.histogram[bucket] != 0) {
+				_appendFormat(out, " [%llu,%llu):%llu", bucket == 0 ? 0ULL : 1ULL << bucket, 1ULL << (bucket + 1),
+				              static_cast<unsigned long long>(entry.histogram[bucket]));
+			}
+		}
+		out += '\n';
+	}
+	return out;
+}
+
+std::string StatsToJson(const uint239_stats& stats) {
+	std::string out;
+	_appendFormat(out, "{\"clock\":\"%s\",\"ops\":{", stats.clock);
+	for (int op = 0; op < kStatsOpCount; ++op) {
+		const uint239_op_stats& entry = stats.ops[op];
+		_appendFormat(out, "%s\"%s\":{\"calls\":%llu,\"samples\":%llu,\"sampled_ticks\":%llu,\"histogram\":[", op == 0 ? "" : ",",
+		              kOpNames[op], static_cast<unsigned long long>(entry.calls), static_cast<unsigned long long>(entry.samples),
+		              static_cast<unsigned long long>(entry.sampled_ticks));
+		for (int bucket = 0; bucket < kStatsBuckets; ++bucket) {
+			_appendFormat(out, "%s%llu", bucket == 0 ? "" : ",", static_cast<unsigned long long>(entry.histogram[bucket]));
+		}
+		out += "]}";
+	}
+	out += "}}";
+	return out;
+}
@@ -0,0 +1,273 @@
+#pragma once
+// Included at the end of number.h: uint_t of every width but 239 on the codec and limb
+// kernels of number_impl.h, instantiated for the width's layout and limb count.
+
+namespace bigint_impl {
+
+template <int Bits>
+constexpr uint_t<Bits> _uintFromLimbs(const std::uint64_t limbs[_uintLayout<Bits>::kLimbs], const _uintShift<Bits>& shift) {
+	uint_t<Bits> result{};
+	_storeLimbs(result, limbs, shift);
+	return result;
+}
+
+template <int Bits>
+constexpr uint_t<Bits> _uintAdd(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	std::uint64_t lhs_limbs[_uintLayout<Bits>::kLimbs];
+	std::uint64_t rhs_limbs[_uintLayout<Bits>::kLimbs];
+	_uintShift<Bits> lhs_shift{};
+	_uintShift<Bits> rhs_shift{};
+	_loadLimbs(lhs, lhs_limbs, lhs_shift);
+	_loadLimbs(rhs, rhs_limbs, rhs_shift);
+	_limbsAdd<Bits>(lhs_limbs, rhs_limbs, lhs_limbs);
+	return _uintFromLimbs<Bits>(lhs_limbs, lhs_shift + rhs_shift);
+}
+
+template <int Bits>
+constexpr uint_t<Bits> _uintSub(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	std::uint64_t lhs_limbs[_uintLayout<Bits>::kLimbs];
+	std::uint64_t rhs_limbs[_uintLayout<Bits>::kLimbs];
+	_uintShift<Bits> lhs_shift{};
+	_uintShift<Bits> rhs_shift{};
+	_loadLimbs(lhs, lhs_limbs, lhs_shift);
+	_loadLimbs(rhs, rhs_limbs, rhs_shift);
+	_limbsSub<Bits>(lhs_limbs, rhs_limbs, lhs_limbs);
+	return _uintFromLimbs<Bits>(lhs_limbs, lhs_shift - rhs_shift);
+}
+
+template <int Bits>
+constexpr uint_t<Bits> _uintMul(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	std::uint64_t lhs_limbs[_uintLayout<Bits>::kLimbs];
+	std::uint64_t rhs_limbs[_uintLayout<Bits>::kLimbs];
+	_uintShift<Bits> lhs_shift{};
+	_uintShift<Bits> rhs_shift{};
+	_loadLimbs(lhs, lhs_limbs, lhs_shift);
+	_loadLimbs(rhs, rhs_limbs, rhs_shift);
+	_limbsMul<Bits>(lhs_limbs, rhs_limbs, lhs_limbs);
+	return _uintFromLimbs<Bits>(lhs_limbs, lhs_shift + rhs_shift);
+}
+
+template <int Bits>
+constexpr uint_divmod_t<Bits> _uintDivMod(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	constexpr int kLimbs = _uintLayout<Bits>::kLimbs;
+	std::uint64_t lhs_limbs[kLimbs];
+	std::uint64_t rhs_limbs[kLimbs];
+	std::uint64_t quotient_limbs[kLimbs];
+	std::uint64_t remainder_limbs[kLimbs];
+	_uintShift<Bits> lhs_shift{};
+	_uintShift<Bits> rhs_shift{};
+	_loadLimbs(lhs, lhs_limbs, lhs_shift);
+	_loadLimbs(rhs, rhs_limbs, rhs_shift);
+	_limbsDivMod<kLimbs>(lhs_limbs, rhs_limbs, quotient_limbs, remainder_limbs);
+	return {_uintFromLimbs<Bits>(quotient_limbs, lhs_shift - rhs_shift), _uintFromLimbs<Bits>(remainder_limbs, lhs_shift - rhs_shift)};
+}
+
+template <int Bits>
+constexpr bool _uintLess(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	std::uint64_t lhs_stored[_uintLayout<Bits>::kDataWords];
+	std::uint64_t rhs_stored[_uintLayout<Bits>::kDataWords];
+	std::uint64_t rotation = _loadAligned(lhs, rhs, lhs_stored, rhs_stored);
+	return _storedLess<Bits>(lhs_stored, rhs_stored, rotation);
+}
+
+template <int Bits>
+constexpr bool _uintEqual(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	std::uint64_t lhs_stored[_uintLayout<Bits>::kDataWords];
+	std::uint64_t rhs_stored[_uintLayout<Bits>::kDataWords];
+	_loadAligned(lhs, rhs, lhs_stored, rhs_stored);
+	return _limbsEqual<_uintLayout<Bits>::kDataWords>(lhs_stored, rhs_stored);
+}
+
+constexpr char _digitSymbol(std::uint64_t digit) {
+	return static_cast<char>(digit < 10 ? '0' + digit : 'a' + (digit - 10));
+}
+
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint64_t GetShift(const uint_t<Bits>& value) {
+	return bigint_impl::_shiftLow64(bigint_impl::_loadShift(value));
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> FromInt(uint32_t value, uint64_t shift) {
+	std::uint64_t limbs[bigint_impl::_uintLayout<Bits>::kLimbs] = {static_cast<std::uint64_t>(value)};
+	return bigint_impl::_uintFromLimbs<Bits>(limbs, shift);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> FromString(const char* str, uint64_t shift) {
+	std::uint64_t limbs[bigint_impl::_uintLayout<Bits>::kLimbs] = {0};
+	bigint_impl::_accumulateString<Bits>(str, limbs);
+	return bigint_impl::_uintFromLimbs<Bits>(limbs, shift);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr std::from_chars_result FromChars(const char* first, const char* last, uint_t<Bits>& value, uint64_t shift, int base) {
+	std::uint64_t limbs[bigint_impl::_uintLayout<Bits>::kLimbs] = {0};
+	std::from_chars_result result = bigint_impl::_parseChars<Bits>(first, last, base, limbs);
+	if (result.ec == std::errc()) {
+		value = bigint_impl::_uintFromLimbs<Bits>(limbs, shift);
+	}
+	return result;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr std::from_chars_result FromChars(std::string_view str, uint_t<Bits>& value, uint64_t shift, int base) {
+	return FromChars(str.data(), str.data() + str.size(), value, shift, base);
+}
+
+// Peels off as many digits per word division as fit a word and writes them backwards.
+template <int Bits> requires _genericWidth<Bits>
+constexpr std::to_chars_result ToChars(char* first, char* last, const uint_t<Bits>& value, int base) {
+	if (base < 2 || base > 36) {
+		return {first, std::errc::invalid_argument};
+	}
+	constexpr int kLimbs = bigint_impl::_uintLayout<Bits>::kLimbs;
+	std::uint64_t limbs[kLimbs];
+	bigint_impl::_uintShift<Bits> shift{};
+	bigint_impl::_loadLimbs(value, limbs, shift);
+	std::uint64_t chunk_divisor = static_cast<std::uint64_t>(base);
+	int chunk_digits = 1;
+	while (chunk_divisor <= ~0ULL / static_cast<std::uint64_t>(base)) {
+		chunk_divisor *= static_cast<std::uint64_t>(base);
+		++chunk_digits;
+	}
+	char buffer[Bits + 64] = {};
+	char* end = buffer + Bits + 64;
+	char* p = end;
+	while (true) {
+		std::uint64_t chunk = 0;
+		bigint_impl::_limbsDivWord<kLimbs>(limbs, chunk_divisor, limbs, chunk);
+		bool done = bigint_impl::_limbsIsZero<kLimbs>(limbs);
+		int digits = 0;
+		while (done ? (chunk != 0 || digits == 0) : digits < chunk_digits) {
+			*--p = bigint_impl::_digitSymbol(chunk % static_cast<std::uint64_t>(base));
+			chunk /= static_cast<std::uint64_t>(base);
+			++digits;
+		}
+		if (done) break;
+	}
+	std::size_t length = static_cast<std::size_t>(end - p);
+	if (static_cast<std::size_t>(last - first) < length) {
+		return {last, std::errc::value_too_large};
+	}
+	std::copy_n(p, length, first);
+	return {first + length, std::errc()};
+}
+
+template <int Bits> requires _genericWidth<Bits>
+std::string ToString(const uint_t<Bits>& value, int base) {
+	char buffer[Bits];
+	std::to_chars_result result = ToChars(buffer, buffer + Bits, value, base);
+	if (result.ec != std::errc()) {
+		throw std::invalid_argument("uint_t unsupported base");
+	}
+	return std::string(buffer, result.ptr);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+std::ostream& operator<<(std::ostream& stream, const uint_t<Bits>& value) {
+	for (int byte_index = 0; byte_index < bigint_impl::_uintLayout<Bits>::kBytes; ++byte_index) {
+		for (int bit = 7; bit >= 0; --bit) {
+			stream << ((value.data[byte_index] >> bit) & 1);
+		}
+		stream << ' ';
+	}
+	return stream;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> operator+(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return bigint_impl::_uintAdd(lhs, rhs);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> operator-(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return bigint_impl::_uintSub(lhs, rhs);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> operator*(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return bigint_impl::_uintMul(lhs, rhs);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> operator/(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return bigint_impl::_uintDivMod(lhs, rhs).quotient;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> operator%(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return bigint_impl::_uintDivMod(lhs, rhs).remainder;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_divmod_t<Bits> DivMod(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return bigint_impl::_uintDivMod(lhs, rhs);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> operator<<(const uint_t<Bits>& lhs, uint64_t shift) {
+	return bigint_impl::_withShift(lhs, bigint_impl::_loadShift(lhs) + bigint_impl::_uintShift<Bits>(shift));
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits> operator>>(const uint_t<Bits>& lhs, uint64_t shift) {
+	return bigint_impl::_withShift(lhs, bigint_impl::_loadShift(lhs) - bigint_impl::_uintShift<Bits>(shift));
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits>& operator+=(uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return lhs = lhs + rhs;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits>& operator-=(uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return lhs = lhs - rhs;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits>& operator*=(uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return lhs = lhs * rhs;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits>& operator/=(uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return lhs = lhs / rhs;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits>& operator%=(uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return lhs = lhs % rhs;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits>& operator<<=(uint_t<Bits>& lhs, uint64_t shift) {
+	return lhs = lhs << shift;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr uint_t<Bits>& operator>>=(uint_t<Bits>& lhs, uint64_t shift) {
+	return lhs = lhs >> shift;
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr bool operator==(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return bigint_impl::_uintEqual(lhs, rhs);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr bool operator!=(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return !(lhs == rhs);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr bool operator<(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return bigint_impl::_uintLess(lhs, rhs);
+}
+
+template <int Bits> requires _genericWidth<Bits>
+constexpr bool operator>(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+	return rhs < lhs;
+}
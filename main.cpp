@@ -1,26 +0,0 @@
-#include <iostream>
-#include <algorithm>
-#include <sys/types.h>
-#include <type_traits>
-#include <vector>
-#include <math.h>
-#include <stdio.h>
-#include <string>
-#include <map>
-#include <cctype>
-#include <cstring>
-#include <set>
-#include <typeinfo>
-#include <bits/stdc++.h>
-#include <deque>
-#include <thread>
-#include "lib/number.cpp"
-
-int main() {
-    uint239_t a,b,c;
-    a=FromInt(10, 0);
-    b=FromInt(6, 0);
-    c = FromString("50", 10);
-    std::cout << a/b << std::endl;
-}
-
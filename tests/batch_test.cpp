@@ -0,0 +1,72 @@
+#include "../lib/number.h"
+#include "test_util.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+
+class BatchTestsSuite : public testing::TestWithParam<std::size_t> {};
+
+TEST_P(BatchTestsSuite, MatchesScalarOperatorsByteForByte) {
+    std::mt19937_64 rng(GetParam());
+    std::vector<uint239_t> lhs = RandomColumn(rng, GetParam());
+    std::vector<uint239_t> rhs = RandomColumn(rng, GetParam());
+    std::vector<uint239_t> result(GetParam());
+    std::vector<int8_t> order(GetParam());
+    std::vector<uint239_work> decoded(GetParam());
+
+    AddBatch(lhs, rhs, result);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_TRUE(SameBytes(result[i], lhs[i] + rhs[i])) << i;
+    }
+    SubBatch(lhs, rhs, result);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_TRUE(SameBytes(result[i], lhs[i] - rhs[i])) << i;
+    }
+    MulBatch(lhs, rhs, result);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_TRUE(SameBytes(result[i], lhs[i] * rhs[i])) << i;
+    }
+    CompareBatch(lhs, lhs, order);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_EQ(order[i], 0) << i;
+    }
+    CompareBatch(lhs, rhs, order);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_EQ(order[i], (rhs[i] < lhs[i]) - (lhs[i] < rhs[i])) << i;
+    }
+
+    DecodeBatch(lhs, decoded);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        uint239_work expected(lhs[i]);
+        ASSERT_EQ(std::memcmp(decoded[i].limbs, expected.limbs, sizeof(expected.limbs)), 0) << i;
+        ASSERT_EQ(decoded[i].shift, expected.shift) << i;
+        decoded[i] *= rhs[i];
+    }
+    EncodeBatch(decoded, result);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_TRUE(SameBytes(result[i], lhs[i] * rhs[i])) << i;
+    }
+
+    result = lhs;
+    AddBatch(result, rhs, result);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_TRUE(SameBytes(result[i], lhs[i] + rhs[i])) << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BatchTests,
+    BatchTestsSuite,
+    testing::Values(0, 1, 3, 4, 7, 8, 9, 17, 1000, 4099)
+);
+
+TEST(BatchTest, ThrowsOnSizeMismatch) {
+    std::vector<uint239_t> lhs(4);
+    std::vector<uint239_t> rhs(5);
+    std::vector<uint239_t> result(4);
+    std::vector<int8_t> order(5);
+    ASSERT_THROW(AddBatch(lhs, rhs, result), std::invalid_argument);
+    ASSERT_THROW(MulBatch(lhs, lhs, std::span<uint239_t>(rhs)), std::invalid_argument);
+    ASSERT_THROW(CompareBatch(lhs, lhs, order), std::invalid_argument);
+}
@@ -0,0 +1,68 @@
+#include "../tools/bigint_calc.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+
+namespace {
+
+std::string Evaluate(const std::string& input, int base = 10) {
+    calc_chunk chunk;
+    chunk.input = input;
+    _calcChunk(chunk, base);
+    return chunk.output;
+}
+
+}  // namespace
+
+TEST(CalcTest, EvaluatesEachOperation) {
+    ASSERT_EQ(Evaluate("add 2 3\n"), "5\n");
+    ASSERT_EQ(Evaluate("sub 10 4\n"), "6\n");
+    ASSERT_EQ(Evaluate("mul 0xff 0x100\n"), "65280\n");
+    ASSERT_EQ(Evaluate("div 100 7\n"), "14\n");
+    ASSERT_EQ(Evaluate("mod 100 7\n"), "2\n");
+    ASSERT_EQ(Evaluate("mul 0xff 0x100\n", 16), "0xff00\n");
+    ASSERT_EQ(Evaluate("sub 0 1\n", 16), "0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffff\n");
+}
+
+TEST(CalcTest, ShiftsFollowTheOperators) {
+    ASSERT_EQ(Evaluate("add 5@3 6@4\n"), "11@7\n");
+    ASSERT_EQ(Evaluate("div 0x10@9 2@4\n"), "8@5\n");
+    ASSERT_EQ(Evaluate("mul 3@1 4\n"), "12@1\n");
+    ASSERT_EQ(Evaluate("sub 9@1 4@3\n"), "5@34359738366\n");
+    ASSERT_EQ(Evaluate("add 9@34359738366 4@3\n"), "13@1\n");
+    ASSERT_EQ(Evaluate("add 9@34359738368 4\n"), "error: bad shift\n");
+}
+
+TEST(CalcTest, KeepsOneOutputLinePerInputLine) {
+    std::string input = "add 1 1\n\n  mul\t2   3  \r\ndiv 1 0\nadd 1\nfoo 1 2\nadd 1 2 3\nadd 1x 2\nadd 1@ 2\n"
+                        "add 0x 1\nadd 0x8" + std::string(59, '0') + " 1\n";
+    std::string expected = "2\n\n6\nerror: division by zero\nerror: expected <op> <lhs> <rhs>\n"
+                           "error: unknown operation\nerror: expected <op> <lhs> <rhs>\nerror: bad operand\n"
+                           "error: bad shift\nerror: bad operand\nerror: operand out of range\n";
+    calc_chunk chunk;
+    chunk.input = input;
+    _calcChunk(chunk, 10);
+    ASSERT_EQ(chunk.output, expected);
+    ASSERT_EQ(chunk.lines, 11u);
+    ASSERT_EQ(chunk.errors, 8u);
+}
+
+TEST(CalcTest, MatchesTheLibrary) {
+    std::mt19937_64 rng(23);
+    const char* ops[] = {"add", "sub", "mul", "div", "mod"};
+    for (int i = 0; i < 1000; ++i) {
+        uint239_t lhs = FromInt(static_cast<uint32_t>(rng()), static_cast<uint32_t>(rng() % 50)) * FromInt(static_cast<uint32_t>(rng()), 0);
+        uint239_t rhs = FromInt(static_cast<uint32_t>(rng()) | 1, static_cast<uint32_t>(rng() % 20));
+        const char* op = ops[i % 5];
+        std::string line = std::string(op) + " " + ToString(lhs) + "@" + std::to_string(GetShift(lhs)) + " 0x" +
+                            ToString(rhs, 16) + "@" + std::to_string(GetShift(rhs)) + "\n";
+        uint239_t expected = i % 5 == 0 ? lhs + rhs : i % 5 == 1 ? lhs - rhs : i % 5 == 2 ? lhs * rhs : i % 5 == 3 ? lhs / rhs : lhs % rhs;
+        std::string shift;
+        if (bigint_impl::_loadShift(expected) != 0) {
+            shift = '@';
+            shift += std::to_string(bigint_impl::_loadShift(expected));
+        }
+        ASSERT_EQ(Evaluate(line), ToString(expected) + shift + "\n") << line;
+    }
+}
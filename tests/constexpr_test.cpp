@@ -0,0 +1,70 @@
+#include "../lib/number.h"
+#include <gtest/gtest.h>
+#include <cstring>
+
+
+constexpr uint239_t kLiteral = 123456789012345678901234567890_u239;
+constexpr uint239_t kMax = 883423532389192164791648750371459257913741948437809479060803100646309887_u239;
+constexpr uint239_t kModulus = 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffed_u239;
+
+static_assert(kLiteral == FromString("123456789012345678901234567890", 0));
+static_assert(kMax == FromInt(0, 0) - FromInt(1, 0));
+static_assert(kMax + FromInt(1, 0) == 0_u239);
+static_assert(kMax * kMax == 1_u239);
+static_assert(kModulus + 19_u239 == 0_u239);
+static_assert(0x10_u239 == 16_u239 && 020_u239 == 16_u239 && 0b10000_u239 == 16_u239);
+static_assert(1'000'000_u239 == FromInt(1000000, 0));
+
+static_assert(FromInt(876, 123) + FromInt(124, 48) == FromInt(1000, 0));
+static_assert(FromInt(876, 123) - FromInt(124, 48) == FromInt(752, 0));
+static_assert(FromInt(876, 123) * FromInt(124, 48) == FromInt(108624, 0));
+static_assert(FromInt(876, 123) / FromInt(124, 48) == FromInt(7, 0));
+static_assert(FromInt(876, 123) % FromInt(124, 48) == FromInt(8, 0));
+static_assert(DivMod(kLiteral * kLiteral, kLiteral).quotient == kLiteral);
+static_assert(DivMod(kLiteral * kLiteral + 5_u239, kLiteral).remainder == 5_u239);
+static_assert(kModulus / 1000000007_u239 * 1000000007_u239 + kModulus % 1000000007_u239 == kModulus);
+
+static_assert(GetShift(FromInt(1, 2024)) == 2024);
+static_assert(GetShift((FromInt(1, 7) << 3) >> 1) == 9);
+static_assert(GetShift(FromInt(1, 2) + FromInt(1, 1)) == 3);
+static_assert(kLiteral < kMax && kMax > kLiteral && kLiteral != kMax);
+
+constexpr uint239_t ParsedAtCompileTime() {
+    uint239_t value{};
+    FromChars("ff", value, 5, 16);
+    return value;
+}
+
+static_assert(ParsedAtCompileTime() == 255_u239);
+static_assert(GetShift(ParsedAtCompileTime()) == 5);
+
+
+TEST(ConstexprTest, CompileTimeValuesMatchRuntime) {
+    volatile uint32_t one = 1;
+    uint239_t runtime_max = FromInt(0, 0) - FromInt(one, 0);
+
+    ASSERT_EQ(std::memcmp(kMax.data, runtime_max.data, 35), 0);
+    ASSERT_EQ(ToString(kLiteral), "123456789012345678901234567890");
+    ASSERT_EQ(ToString(kModulus, 16), "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+}
+
+constexpr uint239_t RunningSum(uint32_t count) {
+    uint239_t sum = 0_u239;
+    for (uint32_t i = 1; i <= count; ++i) {
+        sum += FromInt(i, 1);
+        sum *= 1_u239;
+    }
+    sum <<= 10;
+    return sum;
+}
+
+static_assert(RunningSum(100) == 5050_u239);
+static_assert(GetShift(RunningSum(100)) == 110);
+static_assert([] {
+    uint239_t value = FromInt(3, 7);
+    value -= FromInt(5, 200);
+    return value;
+}() == FromInt(3, 7) - FromInt(5, 200));
+
+static_assert(((uint239_work(12_u239) * 10_u239 + 7_u239) / 0x7_u239).Pack() == 18_u239);
+static_assert(GetShift((uint239_work(FromInt(6, 3)) * FromInt(7, 4)).Pack()) == 7);
@@ -0,0 +1,29 @@
+#include "../lib/number.h"
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <string>
+
+
+TEST(DispatchTest, HonoursForcedTier) {
+    std::string tier = GetKernelTier();
+    ASSERT_TRUE(tier == "generic" || tier == "bmi2" || tier == "avx2" || tier == "avx512") << tier;
+
+    const char* forced = std::getenv("BIGINT_CPU_TIER");
+    if (forced == nullptr) {
+        GTEST_SKIP() << "BIGINT_CPU_TIER is not set";
+    }
+    bool supported = std::string(forced) == "generic";
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if (std::string(forced) == "bmi2") {
+        supported = __builtin_cpu_supports("bmi2");
+    } else if (std::string(forced) == "avx2") {
+        supported = __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("avx2");
+    } else if (std::string(forced) == "avx512") {
+        supported = __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("avx512bw") &&
+                    __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl");
+    }
+#endif
+    if (supported) {
+        ASSERT_EQ(tier, forced);
+    }
+}
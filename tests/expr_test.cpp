@@ -0,0 +1,76 @@
+#include "../lib/number_expr.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <type_traits>
+
+
+constexpr uint239_t kA = 123456789012345678901234567890_u239;
+constexpr uint239_t kB = 0xfedcba9876543210fedcba9876543210_u239;
+constexpr uint239_t kC = 239_u239;
+
+// Plain values keep the eager operators and their exact signatures.
+static_assert(std::is_same_v<decltype(kA * kB + kC), uint239_t>);
+constexpr uint239_t (*kEagerAdd)(const uint239_t&, const uint239_t&) = &operator+;
+static_assert(kEagerAdd(kA, kC) == kA + kC);
+static_assert(!std::is_same_v<decltype(Expr(kA) * kB + kC), uint239_t>);
+static_assert(uint239_t(Expr(kA) * kB + kC) == (uint239_work(kA) * kB + kC).Pack());
+static_assert(uint239_t(kC - Expr(kA) * kB) + kA * kB == kC);
+static_assert(GetShift((Expr(FromInt(1, 3)) + FromInt(2, 5)) << 10) == 18);
+static_assert(GetShift(Expr(FromInt(1, 3)) * FromInt(2, 5) - Expr(FromInt(4, 1)) * FromInt(5, 6)) == 1);
+
+TEST(ExpressionTest, FusedFormulasMatchWorkingTypeByteForByte) {
+    std::mt19937_64 rng(10);
+    auto random_value = [&rng]() {
+        char hex[61];
+        int digits = 1 + static_cast<int>(rng() % 60);
+        for (int i = 0; i < digits; ++i) {
+            hex[i] = "0123456789abcdef"[i == 0 && digits == 60 ? rng() % 8 : rng() % 16];
+        }
+        uint239_t value{};
+        FromChars(hex, hex + digits, value, static_cast<uint32_t>(rng()), 16);
+        return value;
+    };
+    auto same_bytes = [](const uint239_t& lhs, const uint239_t& rhs) {
+        return std::memcmp(lhs.data, rhs.data, 35) == 0;
+    };
+
+    for (int i = 0; i < 2000; ++i) {
+        uint239_t a = random_value();
+        uint239_t b = random_value();
+        uint239_t c = random_value();
+        uint239_t d = random_value();
+        uint32_t k = static_cast<uint32_t>(rng());
+        using W = uint239_work;
+
+        uint239_t result = Expr(a) * b + c;
+        ASSERT_TRUE(same_bytes(result, (W(a) * b + c).Pack()));
+        result = c + Expr(a) * b;
+        ASSERT_TRUE(same_bytes(result, (W(c) + W(a) * b).Pack()));
+        result = Expr(a) * b - Expr(c) * d;
+        ASSERT_TRUE(same_bytes(result, (W(a) * b - W(c) * d).Pack()));
+        result = c - Expr(a) * b;
+        ASSERT_TRUE(same_bytes(result, (W(c) - W(a) * b).Pack()));
+        result = (Expr(a) + b) << k;
+        ASSERT_TRUE(same_bytes(result, ((W(a) + b) << k).Pack()));
+        result = a - ((Expr(b) - c) >> k) * (Expr(d) + a);
+        ASSERT_TRUE(same_bytes(result, (W(a) - ((W(b) - c) >> k) * (W(d) + a)).Pack()));
+        result = Expr(a) * b * c + d;
+        ASSERT_TRUE(same_bytes(result, (W(a) * b * c + d).Pack()));
+
+        ASSERT_EQ(Expr(a) * b + c == d, (W(a) * b + c).Pack() == d);
+        ASSERT_TRUE(same_bytes((Expr(a) * b + c) / (Expr(d) + FromInt(1, 0)), ((W(a) * b + c) / (W(d) + FromInt(1, 0))).Pack()));
+    }
+}
+
+TEST(ExpressionTest, NodesOutliveTemporaryOperands) {
+    auto formula = Expr(FromInt(6, 1)) * FromInt(7, 2) + (Expr(FromInt(5, 0)) << 4);
+    auto shifted = Expr(FromString("12345678901234567890", 3)) >> 3;
+    uint239_t value = formula;
+    uint239_t unshifted = shifted;
+
+    EXPECT_EQ(value, FromInt(47, 0));
+    EXPECT_EQ(GetShift(value), 7u);
+    EXPECT_EQ(unshifted, FromString("12345678901234567890", 0));
+    EXPECT_EQ(GetShift(unshifted), 0u);
+}
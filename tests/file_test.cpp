@@ -0,0 +1,136 @@
+#include "../lib/number_file.h"
+#include "test_util.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+// A file name private to this process, removed when the test ends.
+struct TempFile {
+    std::string path;
+
+    explicit TempFile(const std::string& name)
+        : path((std::filesystem::temp_directory_path() / ("bigint_" + std::to_string(::getpid()) + "_" + name)).string()) {
+    }
+
+    ~TempFile() {
+        std::remove(path.c_str());
+    }
+};
+
+void FlipByte(const std::string& path, std::size_t offset) {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(static_cast<std::streamoff>(offset));
+    char byte = 0;
+    file.read(&byte, 1);
+    byte ^= 0x10;
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(&byte, 1);
+}
+
+}  // namespace
+
+TEST(FileTest, Crc32cKnownValues) {
+    ASSERT_EQ(Crc32c("123456789", 9), 0xE3069283U);
+    ASSERT_EQ(Crc32c("", 0), 0U);
+    std::string text = "The quick brown fox jumps over the lazy dog";
+    uint32_t whole = Crc32c(text.data(), text.size());
+    ASSERT_EQ(Crc32c(text.data() + 10, text.size() - 10, Crc32c(text.data(), 10)), whole);
+}
+
+class FileTestsSuite : public testing::TestWithParam<std::size_t> {};
+
+TEST_P(FileTestsSuite, RoundTripsEveryRecord) {
+    std::mt19937_64 rng(GetParam());
+    std::vector<uint239_t> values = RandomColumn(rng, GetParam());
+    TempFile file("round_trip_" + std::to_string(GetParam()));
+    {
+        uint239_file_writer writer(file.path, 1000);
+        std::size_t i = 0;
+        // Single values and spans of every size, so blocks fill both ways.
+        while (i < values.size()) {
+            std::size_t chunk = std::min<std::size_t>(values.size() - i, rng() % 2500);
+            if (chunk == 0) {
+                writer.Append(values[i++]);
+                continue;
+            }
+            writer.Append(std::span<const uint239_t>(values).subspan(i, chunk));
+            i += chunk;
+        }
+        writer.Close();
+    }
+
+    for (uint239_file_access access : {uint239_file_access::normal, uint239_file_access::random, uint239_file_access::sequential}) {
+        uint239_file_reader reader(file.path, access);
+        ASSERT_EQ(reader.Size(), values.size());
+        ASSERT_EQ(reader.BlockCount(), (values.size() + 999) / 1000);
+        std::span<const uint239_t> mapped = reader.Values();
+        ASSERT_EQ(mapped.size(), values.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            ASSERT_TRUE(SameBytes(mapped[i], values[i])) << i;
+        }
+        std::size_t scanned = 0;
+        reader.Scan([&](std::span<const uint239_t> block) {
+            for (const uint239_t& value : block) {
+                ASSERT_TRUE(SameBytes(value, values[scanned])) << scanned;
+                ++scanned;
+            }
+        });
+        ASSERT_EQ(scanned, values.size());
+        for (std::size_t block = 0; block < reader.BlockCount(); ++block) {
+            ASSERT_EQ(reader.Block(block).data(), mapped.data() + block * 1000);
+        }
+        ASSERT_THROW(reader.Block(reader.BlockCount()), std::out_of_range);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Group, FileTestsSuite, testing::Values(0, 1, 999, 1000, 1001, 25000));
+
+TEST(FileTest, DetectsCorruption) {
+    std::mt19937_64 rng(22);
+    std::vector<uint239_t> values = RandomColumn(rng, 5000);
+    TempFile file("corrupt");
+    {
+        uint239_file_writer writer(file.path, 1024);
+        writer.Append(values);
+    }
+
+    FlipByte(file.path, kFileHeaderSize + 3000 * 35 + 7);
+    {
+        uint239_file_reader reader(file.path);
+        ASSERT_TRUE(reader.VerifyBlock(1));
+        ASSERT_FALSE(reader.VerifyBlock(2));
+        ASSERT_THROW(reader.Block(2), std::runtime_error);
+        ASSERT_THROW(reader.Scan([](std::span<const uint239_t>) {}), std::runtime_error);
+        ASSERT_FALSE(SameBytes(reader.Values()[3000], values[3000]));
+    }
+
+    FlipByte(file.path, 20);
+    ASSERT_THROW(uint239_file_reader reader(file.path), std::runtime_error);
+    FlipByte(file.path, 20);
+    FlipByte(file.path, kFileHeaderSize + 5000 * 35 + 30);
+    ASSERT_THROW(uint239_file_reader reader(file.path), std::runtime_error);
+    std::filesystem::resize_file(file.path, 40);
+    ASSERT_THROW(uint239_file_reader reader(file.path), std::runtime_error);
+}
+
+TEST(FileTest, RejectsBadArgumentsAndPaths) {
+    TempFile file("arguments");
+    ASSERT_THROW(uint239_file_writer(file.path, 0), std::invalid_argument);
+    ASSERT_THROW(uint239_file_writer("/nonexistent-dir/bigint.col"), std::runtime_error);
+    ASSERT_THROW(uint239_file_reader("/nonexistent-dir/bigint.col"), std::runtime_error);
+    uint239_file_writer writer(file.path);
+    writer.Close();
+    writer.Close();
+    ASSERT_THROW(writer.Append(FromInt(1, 0)), std::runtime_error);
+    uint239_file_reader reader(file.path);
+    ASSERT_EQ(reader.Size(), 0u);
+    ASSERT_TRUE(reader.Values().empty());
+}
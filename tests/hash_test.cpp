@@ -0,0 +1,115 @@
+#include "../lib/number_flat.h"
+#include "test_util.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+uint239_t Reshifted(const uint239_t& value, uint32_t shift) {
+    return value << shift;
+}
+
+}  // namespace
+
+static_assert(std::hash<uint239_t>{}(FromInt(5, 0)) == std::hash<uint239_t>{}(FromInt(5, 1234)));
+
+TEST(HashTest, EqualValuesHashAlikeWhateverTheShift) {
+    std::mt19937_64 rng(20);
+    std::hash<uint239_t> hash;
+    for (int i = 0; i < 1000; ++i) {
+        uint239_t value = RandomValue(rng);
+        uint239_t shifted = Reshifted(value, static_cast<uint32_t>(rng()));
+        ASSERT_EQ(value, shifted);
+        ASSERT_EQ(hash(value), hash(shifted)) << i;
+    }
+    ASSERT_NE(hash(FromInt(1, 0)), hash(FromInt(2, 0)));
+    ASSERT_NE(hash(0_u239), hash(1_u239));
+}
+
+TEST(HashTest, UnorderedMapFindsShiftedKeys) {
+    std::unordered_map<uint239_t, int> map;
+    map[FromInt(42, 3)] = 1;
+    map[FromInt(42, 99)] += 1;
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_EQ(map.at(FromInt(42, 0)), 2);
+}
+
+TEST(HashTest, FlatMapMatchesUnorderedMap) {
+    std::mt19937_64 rng(21);
+    std::vector<uint239_t> pool;
+    for (int i = 0; i < 3000; ++i) {
+        pool.push_back(RandomValue(rng, 1 + static_cast<int>(rng() % 60)));
+    }
+    uint239_flat_map<uint64_t> flat;
+    std::unordered_map<uint239_t, uint64_t> reference;
+    for (int step = 0; step < 60000; ++step) {
+        uint239_t key = Reshifted(pool[rng() % pool.size()], static_cast<uint32_t>(rng()));
+        uint64_t value = rng();
+        switch (rng() % 4) {
+            case 0:
+            case 1: {
+                auto [stored, inserted] = flat.Insert(key, value);
+                auto [it, reference_inserted] = reference.emplace(key, value);
+                ASSERT_EQ(inserted, reference_inserted) << step;
+                ASSERT_EQ(*stored, it->second) << step;
+                break;
+            }
+            case 2:
+                ASSERT_EQ(flat.Erase(key), reference.erase(key) == 1) << step;
+                break;
+            default: {
+                const uint64_t* found = flat.Find(key);
+                auto it = reference.find(key);
+                ASSERT_EQ(found != nullptr, it != reference.end()) << step;
+                if (found != nullptr) {
+                    ASSERT_EQ(*found, it->second) << step;
+                }
+            }
+        }
+        ASSERT_EQ(flat.Size(), reference.size()) << step;
+    }
+    std::size_t visited = 0;
+    flat.ForEach([&](const uint239_t& key, uint64_t value) {
+        ASSERT_EQ(GetShift(key), 0);
+        ASSERT_EQ(reference.at(key), value);
+        ++visited;
+    });
+    ASSERT_EQ(visited, reference.size());
+}
+
+TEST(HashTest, FlatSetStoresCanonicalKeys) {
+    uint239_flat_set set;
+    set.Reserve(1000);
+    ASSERT_TRUE(set.Empty());
+    ASSERT_TRUE(set.Insert(FromInt(7, 5)));
+    ASSERT_FALSE(set.Insert(FromInt(7, 11)));
+    ASSERT_TRUE(set.Contains(FromInt(7, 0)));
+    ASSERT_FALSE(set.Contains(FromInt(8, 5)));
+    set.ForEach([](const uint239_t& key) {
+        ASSERT_EQ(std::memcmp(key.data, FromInt(7, 0).data, 35), 0);
+    });
+    for (uint32_t i = 0; i < 5000; ++i) {
+        set.Insert(FromInt(i, i));
+    }
+    ASSERT_EQ(set.Size(), 5000u);
+    for (uint32_t i = 0; i < 5000; i += 2) {
+        ASSERT_TRUE(set.Erase(FromInt(i, 0)));
+    }
+    ASSERT_EQ(set.Size(), 2500u);
+    for (uint32_t i = 0; i < 5000; ++i) {
+        ASSERT_EQ(set.Contains(FromInt(i, 3 * i)), i % 2 == 1) << i;
+    }
+    set.Clear();
+    ASSERT_TRUE(set.Empty());
+    ASSERT_FALSE(set.Contains(FromInt(1, 0)));
+
+    uint239_flat_map<std::string> names;
+    names[FromInt(1, 9)] = "one";
+    names[FromInt(1, 0)] += "!";
+    ASSERT_EQ(*names.Find(FromInt(1, 4)), "one!");
+}
@@ -0,0 +1,142 @@
+#include "../lib/number.h"
+#include "test_util.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+uint239_t Narrow(const uint_t<479>& value) {
+    return FromString(ToString(value).c_str(), 0);
+}
+
+// Moduli from one limb up to the full width, with both parities and the limb boundaries.
+std::vector<uint239_t> Moduli(std::mt19937_64& rng) {
+    std::vector<uint239_t> moduli = {
+        2_u239, 3_u239, 1000_u239,
+        0xffffffffffffffff_u239, 0x10000000000000000_u239, 0x10000000000000001_u239,
+        0x7fffffffffffffffffffffffffffffff_u239,
+        0x100000000000000000000000000000000_u239,
+        0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffff_u239,
+        0x7ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe_u239,
+    };
+    for (int i = 0; i < 30; ++i) {
+        uint239_t modulus = RandomValue(rng);
+        if (modulus > 1_u239) {
+            moduli.push_back(modulus);
+        }
+    }
+    return moduli;
+}
+
+}  // namespace
+
+TEST(ModTest, MatchesWideReference) {
+    std::mt19937_64 rng(17);
+    for (const uint239_t& modulus : Moduli(rng)) {
+        uint239_mod_context context(modulus);
+        uint_t<479> m = Widen(modulus);
+        ASSERT_EQ(context.Modulus(), modulus);
+        for (int i = 0; i < 200; ++i) {
+            uint239_t a = RandomValue(rng);
+            uint239_t b = RandomValue(rng);
+            uint_t<479> x = Widen(a) % m;
+            uint_t<479> y = Widen(b) % m;
+            ASSERT_EQ(context.Reduce(a), Narrow(x)) << ToString(modulus) << ' ' << i;
+            ASSERT_EQ(context.AddMod(a, b), Narrow((x + y) % m)) << ToString(modulus) << ' ' << i;
+            ASSERT_EQ(context.SubMod(a, b), Narrow((x + m - y) % m)) << ToString(modulus) << ' ' << i;
+            ASSERT_EQ(context.MulMod(a, b), Narrow(x * y % m)) << ToString(modulus) << ' ' << i;
+            ASSERT_EQ(GetShift(context.MulMod(a, b)), 0);
+        }
+    }
+}
+
+TEST(ModTest, PowModMatchesSquareAndMultiply) {
+    std::mt19937_64 rng(19);
+    for (const uint239_t& modulus : Moduli(rng)) {
+        uint239_mod_context context(modulus);
+        for (int i = 0; i < 10; ++i) {
+            uint239_t base = RandomValue(rng);
+            uint239_t exponent = RandomValue(rng, 1 + static_cast<int>(rng() % 60));
+            uint239_t expected = context.Reduce(1_u239);
+            std::string bits = ToString(exponent, 2);
+            for (char bit : bits) {
+                expected = context.MulMod(expected, expected);
+                if (bit == '1') {
+                    expected = context.MulMod(expected, base);
+                }
+            }
+            ASSERT_EQ(context.PowMod(base, exponent), expected) << ToString(modulus) << ' ' << i;
+        }
+        ASSERT_EQ(context.PowMod(0_u239, 0_u239), 1_u239);
+        ASSERT_EQ(context.PowMod(0_u239, 5_u239), 0_u239);
+    }
+}
+
+TEST(ModTest, PowModKnownValues) {
+    uint239_mod_context even(1000000000000000000000000000000_u239);
+    ASSERT_EQ(even.PowMod(7_u239, 1000003_u239), 611862078332906089245800000343_u239);
+    uint239_mod_context odd(0x400000000000000000000000000000000000000000000000000000000003_u239);
+    uint239_t exponent = 0x100000000000000000000000000000000000000000000003039_u239;
+    ASSERT_EQ(odd.PowMod(123456789_u239, exponent),
+              318496594541920249945630410541456858259222068552263345519642867406791305_u239);
+    uint239_t p = 0x7fffffffffffffffffffffffffffffff_u239;
+    uint239_mod_context prime(p);
+    ASSERT_EQ(prime.PowMod(p - 5_u239, p - 1_u239), 1_u239);
+}
+
+TEST(ModTest, InvMod) {
+    std::mt19937_64 rng(23);
+    for (const uint239_t& modulus : Moduli(rng)) {
+        uint239_mod_context context(modulus);
+        for (int i = 0; i < 50; ++i) {
+            uint239_t value = RandomValue(rng);
+            if (Gcd(value, modulus) != 1_u239) {
+                ASSERT_THROW(context.InvMod(value), std::invalid_argument) << ToString(modulus) << ' ' << i;
+                continue;
+            }
+            uint239_t inverse = context.InvMod(value);
+            ASSERT_EQ(context.MulMod(value, inverse), 1_u239) << ToString(modulus) << ' ' << i;
+            ASSERT_TRUE(inverse < modulus);
+        }
+    }
+    uint239_mod_context even(1000_u239);
+    ASSERT_EQ(even.InvMod(3_u239), 667_u239);
+    ASSERT_THROW(even.InvMod(250_u239), std::invalid_argument);
+    ASSERT_THROW(even.InvMod(0_u239), std::invalid_argument);
+}
+
+TEST(ModTest, MontgomeryForm) {
+    std::mt19937_64 rng(29);
+    for (const uint239_t& modulus : Moduli(rng)) {
+        uint239_mod_context context(modulus);
+        if (!(modulus % 2_u239 == 1_u239)) {
+            ASSERT_THROW(context.ToMontgomery(1_u239), std::invalid_argument);
+            continue;
+        }
+        for (int i = 0; i < 50; ++i) {
+            uint239_t a = RandomValue(rng);
+            uint239_t b = RandomValue(rng);
+            uint239_t a_form = context.ToMontgomery(a);
+            uint239_t b_form = context.ToMontgomery(b);
+            ASSERT_EQ(context.FromMontgomery(a_form), context.Reduce(a)) << ToString(modulus) << ' ' << i;
+            ASSERT_EQ(context.FromMontgomery(context.MontgomeryMul(a_form, b_form)), context.MulMod(a, b))
+                << ToString(modulus) << ' ' << i;
+        }
+    }
+}
+
+TEST(ModTest, InputShiftIsIgnored) {
+    uint239_mod_context context(FromInt(97, 11));
+    ASSERT_EQ(GetShift(context.Modulus()), 0);
+    uint239_t product = context.MulMod(FromInt(50, 3), FromInt(60, 1000));
+    ASSERT_EQ(product, FromInt(3000 % 97, 0));
+    ASSERT_EQ(GetShift(product), 0);
+    ASSERT_EQ(context.SubMod(FromInt(5, 1), FromInt(7, 2)), FromInt(95, 0));
+}
+
+TEST(ModTest, RejectsSmallModulus) {
+    ASSERT_THROW(uint239_mod_context(0_u239), std::invalid_argument);
+    ASSERT_THROW(uint239_mod_context(1_u239), std::invalid_argument);
+}
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <bitset>
 #include <cstring>
+#include <random>
 #include <tuple>
 
 
@@ -174,4 +175,495 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(TValue{"99999999999999999999", 99}, TValue{"1", 0}, TValue{"100000000000000000000", 99}, TValue{"99999999999999999998", 99},  TValue{"99999999999999999999", 99}, TValue{"99999999999999999999", 99}),
         std::make_tuple(TValue{"1000", 1000}, TValue{"2", 999}, TValue{"1002", 1999}, TValue{"998", 1},  TValue{"2000", 1999}, TValue{"500", 1})
     )
-);
\ No newline at end of file
+);
+
+TEST(WideArithmeticTest, WrapsAroundModulus) {
+    uint239_t zero = FromInt(0, 0);
+    uint239_t one = FromInt(1, 0);
+    uint239_t max = zero - one;
+
+    ASSERT_EQ(max + one, zero);
+    ASSERT_EQ(max * max, one);
+    ASSERT_EQ(max / one, max);
+    ASSERT_EQ(max / max, one);
+    ASSERT_TRUE(one < max);
+    ASSERT_TRUE(max > FromInt(4294967295, 17));
+}
+
+TEST(WideArithmeticTest, CarriesAcrossWords) {
+    uint239_t base = FromInt(4294967295, 3);
+    uint239_t power = FromInt(1, 0);
+    for (int i = 0; i < 7; ++i) {
+        power = power * base;
+    }
+
+    uint239_t quotient = power;
+    for (int i = 0; i < 7; ++i) {
+        quotient = quotient / base;
+    }
+    ASSERT_EQ(quotient, FromInt(1, 0));
+    ASSERT_EQ(power - power, FromInt(0, 0));
+    ASSERT_EQ((power + base) - base, power);
+    ASSERT_TRUE(power / base < power);
+}
+
+
+// Bit-per-bit reference implementation of the I-Endian layout.
+namespace reference {
+
+constexpr int kBytes = 35;
+constexpr int kDataBits = kBytes * 7;
+constexpr int kSignificantBits = 239;
+constexpr int kPaddingBits = kDataBits - kSignificantBits;
+
+// padding gives the kPaddingBits bits above the value, which the layout leaves unused.
+uint239_t Encode(const uint8_t bits_le[kSignificantBits], uint64_t shift, uint8_t padding = 0) {
+    uint8_t canonical[kDataBits] = {0};
+    for (int i = 0; i < kPaddingBits; ++i) {
+        canonical[kPaddingBits - 1 - i] = static_cast<uint8_t>((padding >> i) & 1);
+    }
+    for (int i = 0; i < kSignificantBits; ++i) {
+        canonical[kPaddingBits + kSignificantBits - 1 - i] = bits_le[i];
+    }
+    int shift_mod = static_cast<int>(shift % kDataBits);
+    uint8_t stored[kDataBits];
+    for (int i = 0; i < kDataBits; ++i) {
+        stored[i] = canonical[(i + shift_mod) % kDataBits];
+    }
+    uint239_t result;
+    for (int byte_index = 0; byte_index < kBytes; ++byte_index) {
+        uint8_t byte = 0;
+        for (int bit = 0; bit < 7; ++bit) {
+            byte = static_cast<uint8_t>((byte << 1) | stored[byte_index * 7 + bit]);
+        }
+        uint8_t service = static_cast<uint8_t>((shift >> (kBytes - 1 - byte_index)) & 1);
+        result.data[byte_index] = static_cast<uint8_t>(byte | (service << 7));
+    }
+    return result;
+}
+
+uint239_t FromLimbs(const uint64_t limbs[4], uint64_t shift, uint8_t padding = 0) {
+    uint8_t bits_le[kSignificantBits];
+    for (int i = 0; i < kSignificantBits; ++i) {
+        bits_le[i] = static_cast<uint8_t>((limbs[i / 64] >> (i % 64)) & 1);
+    }
+    return Encode(bits_le, shift, padding);
+}
+
+} // namespace reference
+
+
+class CodecTestSuite : public testing::TestWithParam<uint64_t /* seed */> {
+};
+
+TEST_P(CodecTestSuite, MatchesReferenceForEveryRotation) {
+    std::mt19937_64 rng(GetParam());
+    uint8_t bits_le[reference::kSignificantBits];
+    for (int i = 0; i < reference::kSignificantBits; ++i) {
+        bits_le[i] = static_cast<uint8_t>(rng() & 1);
+    }
+    uint239_t canonical = reference::Encode(bits_le, 0);
+
+    for (uint64_t shift = 0; shift < 2 * reference::kDataBits; ++shift) {
+        uint239_t expected = reference::Encode(bits_le, shift);
+        uint239_t reencoded = canonical + FromInt(0, static_cast<uint32_t>(shift));
+        uint239_t roundtrip = expected + FromInt(0, 0);
+
+        ASSERT_EQ(std::memcmp(reencoded.data, expected.data, 35), 0) << "shift " << shift;
+        ASSERT_EQ(std::memcmp(roundtrip.data, expected.data, 35), 0) << "shift " << shift;
+        ASSERT_EQ(GetShift(expected), shift);
+    }
+
+    uint64_t high_shift = (1ULL << 35) - 1;
+    uint239_t expected = reference::Encode(bits_le, high_shift);
+    uint239_t roundtrip = expected + FromInt(0, 0);
+    ASSERT_EQ(std::memcmp(roundtrip.data, expected.data, 35), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Group,
+    CodecTestSuite,
+    testing::Values(1, 2, 3, 239, 2024, 77777)
+);
+
+
+TEST_P(CodecTestSuite, ShiftsRotateWithoutDecoding) {
+    std::mt19937_64 rng(GetParam());
+    uint8_t bits_le[reference::kSignificantBits];
+    for (int i = 0; i < reference::kSignificantBits; ++i) {
+        bits_le[i] = static_cast<uint8_t>(rng() & 1);
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        uint64_t shift = rng() & ((1ULL << 35) - 1);
+        uint32_t delta = static_cast<uint32_t>(rng());
+        uint239_t value = reference::Encode(bits_le, shift);
+
+        uint239_t shifted_left = value << delta;
+        uint239_t expected_left = reference::Encode(bits_le, (shift + delta) & ((1ULL << 35) - 1));
+        ASSERT_EQ(std::memcmp(shifted_left.data, expected_left.data, 35), 0);
+
+        uint239_t shifted_right = value >> delta;
+        uint239_t expected_right = reference::Encode(bits_le, (shift - delta) & ((1ULL << 35) - 1));
+        ASSERT_EQ(std::memcmp(shifted_right.data, expected_right.data, 35), 0);
+    }
+}
+
+TEST_P(CodecTestSuite, OrderingIgnoresShift) {
+    std::mt19937_64 rng(GetParam());
+    auto compare = [](const uint8_t* lhs, const uint8_t* rhs) {
+        for (int i = reference::kSignificantBits - 1; i >= 0; --i) {
+            if (lhs[i] != rhs[i]) {
+                return lhs[i] < rhs[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    };
+
+    for (int i = 0; i < 500; ++i) {
+        uint8_t lhs_bits[reference::kSignificantBits];
+        uint8_t rhs_bits[reference::kSignificantBits];
+        int common_prefix = static_cast<int>(rng() % (reference::kSignificantBits + 1));
+        for (int bit = 0; bit < reference::kSignificantBits; ++bit) {
+            lhs_bits[bit] = static_cast<uint8_t>(rng() & 1);
+            rhs_bits[bit] = bit >= reference::kSignificantBits - common_prefix ? lhs_bits[bit] : static_cast<uint8_t>(rng() & 1);
+        }
+        uint64_t lhs_shift = rng() % 600;
+        uint64_t rhs_shift = i % 2 == 0 ? lhs_shift : rng() % 600;
+        uint239_t lhs = reference::Encode(lhs_bits, lhs_shift);
+        uint239_t rhs = reference::Encode(rhs_bits, rhs_shift);
+
+        int expected = compare(lhs_bits, rhs_bits);
+        ASSERT_EQ(lhs == rhs, expected == 0);
+        ASSERT_EQ(lhs != rhs, expected != 0);
+        ASSERT_EQ(lhs < rhs, expected < 0);
+        ASSERT_EQ(lhs > rhs, expected > 0);
+    }
+}
+
+TEST_P(CodecTestSuite, OrderingIgnoresPadding) {
+    std::mt19937_64 rng(GetParam());
+    for (int i = 0; i < 500; ++i) {
+        uint8_t lhs_bits[reference::kSignificantBits];
+        uint8_t rhs_bits[reference::kSignificantBits];
+        for (int bit = 0; bit < reference::kSignificantBits; ++bit) {
+            lhs_bits[bit] = static_cast<uint8_t>(rng() & 1);
+            rhs_bits[bit] = i % 2 == 0 ? lhs_bits[bit] : static_cast<uint8_t>(rng() & 1);
+        }
+        uint64_t lhs_shift = rng() % 600;
+        uint64_t rhs_shift = rng() % 600;
+        uint8_t padding = static_cast<uint8_t>(1 + rng() % ((1 << reference::kPaddingBits) - 1));
+        uint239_t lhs = reference::Encode(lhs_bits, lhs_shift, padding);
+        uint239_t rhs = reference::Encode(rhs_bits, rhs_shift);
+        uint239_t lhs_clean = reference::Encode(lhs_bits, lhs_shift);
+
+        ASSERT_EQ(lhs == rhs, lhs_clean == rhs);
+        ASSERT_EQ(lhs < rhs, lhs_clean < rhs);
+        ASSERT_EQ(rhs < lhs, rhs < lhs_clean);
+        ASSERT_TRUE((lhs <=> rhs) == (lhs_clean <=> rhs));
+        ASSERT_EQ(lhs, lhs_clean);
+    }
+}
+
+
+class DivModTestsSuite
+    : public testing::TestWithParam<
+        std::tuple<
+            TValue, // lhs
+            TValue, // rhs
+            TValue, // quotient
+            TValue  // remainder
+        >
+    >
+{
+};
+
+TEST_P(DivModTestsSuite, DivModTest) {
+    uint239_t a = FromString(std::get<0>(GetParam()).first, std::get<0>(GetParam()).second);
+    uint239_t b = FromString(std::get<1>(GetParam()).first, std::get<1>(GetParam()).second);
+
+    uint239_divmod_t result = DivMod(a, b);
+    uint239_t quotient = FromString(std::get<2>(GetParam()).first, std::get<2>(GetParam()).second);
+    uint239_t remainder = FromString(std::get<3>(GetParam()).first, std::get<3>(GetParam()).second);
+
+    ASSERT_EQ(result.quotient, quotient);
+    ASSERT_EQ(result.remainder, remainder);
+    ASSERT_EQ(a / b, quotient);
+    ASSERT_EQ(a % b, remainder);
+    ASSERT_EQ(GetShift(result.quotient), std::get<2>(GetParam()).second);
+    ASSERT_EQ(GetShift(result.remainder), std::get<3>(GetParam()).second);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Group,
+    DivModTestsSuite,
+    testing::Values(
+        std::make_tuple(TValue{"7", 0}, TValue{"2", 0}, TValue{"3", 0}, TValue{"1", 0}),
+        std::make_tuple(TValue{"2024", 2024}, TValue{"8", 239}, TValue{"253", 1785}, TValue{"0", 1785}),
+        std::make_tuple(TValue{"876", 123}, TValue{"124", 48}, TValue{"7", 75}, TValue{"8", 75}),
+        std::make_tuple(TValue{"5", 3}, TValue{"10", 3}, TValue{"0", 0}, TValue{"5", 0}),
+        std::make_tuple(TValue{"18446744073709551615", 1}, TValue{"4294967296", 0}, TValue{"4294967295", 1}, TValue{"4294967295", 1}),
+        std::make_tuple(TValue{"18446744073709551615", 9}, TValue{"1000000007", 2}, TValue{"18446743944", 7}, TValue{"582344007", 7})
+    )
+);
+
+
+TEST(DivModTest, ThrowsOnZeroDivisor) {
+    ASSERT_THROW(FromInt(1, 0) / FromInt(0, 0), std::runtime_error);
+    ASSERT_THROW(FromInt(1, 0) % FromInt(0, 0), std::runtime_error);
+    ASSERT_THROW(DivMod(FromInt(1, 0), FromInt(0, 0)), std::runtime_error);
+}
+
+TEST(DivModTest, KnuthAddBack) {
+    // Quotient digit estimate is one too large and needs the add-back step.
+    const uint64_t dividend[4] = {0, 0, 0x8000000000000000ULL, 0x7FFFFFFFFFFFULL};
+    const uint64_t divisor[4] = {1, 0, 0x8000000000000000ULL, 0};
+    uint239_t a = reference::FromLimbs(dividend, 5);
+    uint239_t b = reference::FromLimbs(divisor, 3);
+
+    uint239_divmod_t result = DivMod(a, b);
+    ASSERT_EQ(result.quotient * b + result.remainder, a);
+    ASSERT_TRUE(result.remainder < b);
+}
+
+TEST(DivModTest, MatchesDefinitionOnRandomOperands) {
+    std::mt19937_64 rng(239);
+    auto random_limbs = [&rng](uint64_t limbs[4], int bits) {
+        for (int i = 0; i < 4; ++i) {
+            limbs[i] = 0;
+        }
+        int pattern = static_cast<int>(rng() % 3);
+        for (int bit = 0; bit < bits; ++bit) {
+            uint64_t value = pattern == 0 ? rng() & 1 : pattern == 1 ? 1 : (bit % 64 == 63);
+            limbs[bit / 64] |= value << (bit % 64);
+        }
+        limbs[(bits - 1) / 64] |= 1ULL << ((bits - 1) % 64);
+    };
+
+    for (int i = 0; i < 3000; ++i) {
+        uint64_t dividend[4];
+        uint64_t divisor[4];
+        int dividend_bits = 1 + static_cast<int>(rng() % 239);
+        int divisor_bits = 1 + static_cast<int>(rng() % dividend_bits);
+        random_limbs(dividend, dividend_bits);
+        random_limbs(divisor, divisor_bits);
+        if (i % 5 == 0) {
+            for (int limb = 0; limb < 4; ++limb) {
+                divisor[limb] = limb == (divisor_bits - 1) / 64 ? 1ULL << ((divisor_bits - 1) % 64) : 0;
+            }
+        }
+        uint239_t a = reference::FromLimbs(dividend, rng() % 245);
+        uint239_t b = reference::FromLimbs(divisor, rng() % 245);
+
+        uint239_divmod_t result = DivMod(a, b);
+        ASSERT_TRUE(result.remainder < b);
+        ASSERT_EQ(result.quotient * b + result.remainder, a);
+        ASSERT_EQ(a / b, result.quotient);
+        ASSERT_EQ(a % b, result.remainder);
+    }
+}
+
+
+TEST(ParsingTest, FromStringCoversFullWidth) {
+    uint239_t max = FromInt(0, 0) - FromInt(1, 0);
+    ASSERT_EQ(FromString("883423532389192164791648750371459257913741948437809479060803100646309887", 0), max);
+
+    uint239_t power = FromInt(1, 0);
+    for (int i = 0; i < 150; ++i) {
+        power = power * FromInt(3, 0);
+    }
+    ASSERT_EQ(FromString("369988485035126972924700782451696644186473100389722973815184405301748249", 7), power);
+
+    uint239_t ten_to_71 = FromInt(1, 0);
+    for (int i = 0; i < 71; ++i) {
+        ten_to_71 = ten_to_71 * FromInt(10, 0);
+    }
+    ASSERT_EQ(FromString("100000000000000000000000000000000000000000000000000000000000000000000000", 3), ten_to_71);
+    ASSERT_EQ(FromString("1 000 000", 0), FromInt(1000000, 0));
+}
+
+TEST(ParsingTest, FromCharsReportsEndAndErrors) {
+    uint239_t value = FromInt(42, 0);
+
+    const char digits[] = "12345678901234567890123x";
+    std::from_chars_result result = FromChars(digits, digits + sizeof(digits) - 1, value, 5);
+    ASSERT_EQ(result.ec, std::errc());
+    ASSERT_EQ(result.ptr, digits + 23);
+    ASSERT_EQ(value, FromString("12345678901234567890123", 0));
+    ASSERT_EQ(GetShift(value), 5);
+
+    uint239_t untouched = FromInt(42, 0);
+    std::string_view letters = "x123";
+    result = FromChars(letters, untouched, 0);
+    ASSERT_EQ(result.ec, std::errc::invalid_argument);
+    ASSERT_EQ(result.ptr, letters.data());
+    ASSERT_EQ(untouched, FromInt(42, 0));
+
+    std::string_view too_big = "883423532389192164791648750371459257913741948437809479060803100646309888 ";
+    result = FromChars(too_big, untouched, 0);
+    ASSERT_EQ(result.ec, std::errc::result_out_of_range);
+    ASSERT_EQ(result.ptr, too_big.data() + too_big.size() - 1);
+    ASSERT_EQ(untouched, FromInt(42, 0));
+}
+
+TEST(ParsingTest, FromCharsAcceptsOtherBases) {
+    uint239_t value;
+    ASSERT_EQ(FromChars("7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", value, 0, 16).ec, std::errc());
+    ASSERT_EQ(value, FromInt(0, 0) - FromInt(1, 0));
+    ASSERT_EQ(FromChars("FfFf", value, 0, 16).ec, std::errc());
+    ASSERT_EQ(value, FromInt(65535, 0));
+    std::string_view binary = "1012";
+    ASSERT_EQ(FromChars(binary, value, 0, 2).ptr, binary.data() + 3);
+    ASSERT_EQ(value, FromInt(5, 0));
+    ASSERT_EQ(FromChars("800000000000000000000000000000000000000000000000000000000000", value, 0, 16).ec, std::errc::result_out_of_range);
+}
+
+
+TEST(FormattingTest, ToStringWritesDecimalAndHex) {
+    uint239_t max = FromInt(0, 0) - FromInt(1, 0);
+    ASSERT_EQ(ToString(max), "883423532389192164791648750371459257913741948437809479060803100646309887");
+    ASSERT_EQ(ToString(max, 16), "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+    ASSERT_EQ(ToString(FromInt(0, 17)), "0");
+    ASSERT_EQ(ToString(FromInt(0, 17), 16), "0");
+    ASSERT_EQ(ToString(FromInt(2024, 2024)), "2024");
+    ASSERT_EQ(ToString(FromInt(255, 3), 2), "11111111");
+    ASSERT_EQ(ToString(FromInt(35, 0), 36), "z");
+    ASSERT_EQ(ToString(FromString("100000000000000000000000000000000000001", 9)), "100000000000000000000000000000000000001");
+    ASSERT_THROW(ToString(max, 1), std::invalid_argument);
+}
+
+TEST(FormattingTest, ToCharsRespectsBuffer) {
+    char buffer[8];
+    std::to_chars_result result = ToChars(buffer, buffer + sizeof(buffer), FromInt(12345678, 0), 10);
+    ASSERT_EQ(result.ec, std::errc());
+    ASSERT_EQ(std::string(buffer, result.ptr), "12345678");
+
+    result = ToChars(buffer, buffer + sizeof(buffer), FromInt(123456789, 0), 10);
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+    ASSERT_EQ(result.ptr, buffer + sizeof(buffer));
+}
+
+TEST(FormattingTest, RoundTripsThroughFromChars) {
+    std::mt19937_64 rng(2024);
+    for (int i = 0; i < 500; ++i) {
+        uint64_t limbs[4] = {rng(), rng(), rng(), rng() >> (17 + rng() % 47)};
+        uint239_t value = reference::FromLimbs(limbs, rng() % 245);
+        int base = 2 + static_cast<int>(rng() % 35);
+
+        std::string text = ToString(value, base);
+        uint239_t parsed;
+        std::from_chars_result result = FromChars(text, parsed, 0, base);
+        ASSERT_EQ(result.ec, std::errc()) << text;
+        ASSERT_EQ(result.ptr, text.data() + text.size());
+        ASSERT_EQ(parsed, value) << text << " base " << base;
+    }
+}
+
+
+TEST(InPlaceTest, MatchesBinaryOperatorsByteForByte) {
+    std::mt19937_64 rng(8);
+    auto random_value = [&rng](int kind) {
+        uint64_t limbs[4] = {rng(), rng() >> (rng() % 64), 0, 0};
+        if (kind == 0) {
+            limbs[0] = limbs[1] = 0;
+        } else if (kind == 1) {
+            limbs[0] = 1;
+            limbs[1] = 0;
+        } else if (kind > 4) {
+            limbs[2] = rng();
+            limbs[3] = rng() >> 17;
+        }
+        return reference::FromLimbs(limbs, rng() & ((1ULL << 35) - 1));
+    };
+    auto same_bytes = [](const uint239_t& lhs, const uint239_t& rhs) {
+        return std::memcmp(lhs.data, rhs.data, 35) == 0;
+    };
+
+    for (int i = 0; i < 2000; ++i) {
+        uint239_t a = random_value(static_cast<int>(rng() % 8) + 2);
+        if (i % 2 == 1) {
+            // Padding left set in lhs is cleared by both forms, even for an identity rhs.
+            uint64_t limbs[4] = {rng(), rng(), rng(), rng() >> 17};
+            uint8_t padding = static_cast<uint8_t>(1 + rng() % ((1 << reference::kPaddingBits) - 1));
+            a = reference::FromLimbs(limbs, rng() & ((1ULL << 35) - 1), padding);
+        }
+        uint239_t b = random_value(static_cast<int>(rng() % 8));
+        uint32_t shift = static_cast<uint32_t>(rng());
+
+        uint239_t value = a;
+        ASSERT_TRUE(same_bytes(value += b, a + b));
+        value = a;
+        ASSERT_TRUE(same_bytes(value -= b, a - b));
+        value = a;
+        ASSERT_TRUE(same_bytes(value *= b, a * b));
+        value = a;
+        ASSERT_TRUE(same_bytes(value <<= shift, a << shift));
+        value = a;
+        ASSERT_TRUE(same_bytes(value >>= shift, a >> shift));
+        if (b != FromInt(0, 0)) {
+            value = a;
+            ASSERT_TRUE(same_bytes(value /= b, a / b));
+            value = a;
+            ASSERT_TRUE(same_bytes(value %= b, a % b));
+        }
+
+        value = a;
+        AddInPlace(value, value);
+        ASSERT_TRUE(same_bytes(value, a + a));
+        value = a;
+        MulInPlace(value, value);
+        ASSERT_TRUE(same_bytes(value, a * a));
+        value = a;
+        SubInPlace(value, value);
+        ASSERT_TRUE(same_bytes(value, a - a));
+    }
+
+    uint239_t value = FromInt(7, 0);
+    ASSERT_THROW(value /= FromInt(0, 3), std::runtime_error);
+    ASSERT_THROW(value %= FromInt(0, 3), std::runtime_error);
+}
+
+TEST(WorkTest, ChainsMatchPackedOperatorsByteForByte) {
+    std::mt19937_64 rng(9);
+    auto random_value = [&rng]() {
+        uint64_t limbs[4] = {rng(), rng(), rng(), rng() >> 17};
+        for (int i = static_cast<int>(rng() % 4); i < 3; ++i) {
+            limbs[i + 1] = 0;
+        }
+        return reference::FromLimbs(limbs, rng() & ((1ULL << 35) - 1));
+    };
+    auto same_bytes = [](const uint239_t& lhs, const uint239_t& rhs) {
+        return std::memcmp(lhs.data, rhs.data, 35) == 0;
+    };
+
+    for (int i = 0; i < 2000; ++i) {
+        uint239_t a = random_value();
+        uint239_t b = random_value();
+        uint239_t c = random_value();
+        uint239_t d = random_value();
+        uint32_t shift = static_cast<uint32_t>(rng());
+
+        ASSERT_TRUE(same_bytes(uint239_work(a).Pack(), a));
+        ASSERT_EQ(GetShift(uint239_work(a)), GetShift(a));
+        ASSERT_TRUE(same_bytes((uint239_work(a) * b + c).Pack(), a * b + c));
+        ASSERT_TRUE(same_bytes((uint239_work(a) - b * uint239_work(c)).Pack(), a - b * c));
+        ASSERT_TRUE(same_bytes(((uint239_work(a) << shift) >> 7).Pack(), (a << shift) >> 7));
+        if (d != FromInt(0, 0)) {
+            ASSERT_TRUE(same_bytes(((uint239_work(a) * b + c) / d).Pack(), (a * b + c) / d));
+            ASSERT_TRUE(same_bytes((uint239_work(a) % d).Pack(), a % d));
+        }
+
+        uint239_work value = a;
+        value += value;
+        value *= value;
+        value -= b;
+        ASSERT_TRUE(same_bytes(value.Pack(), (a + a) * (a + a) - b));
+        ASSERT_EQ(uint239_work(a) == uint239_work(b), a == b);
+        ASSERT_EQ(uint239_work(a) < uint239_work(b), a < b);
+        ASSERT_EQ(uint239_work(a) > uint239_work(b), a > b);
+    }
+
+    uint239_work value = FromInt(7, 0);
+    ASSERT_THROW(value /= FromInt(0, 3), std::runtime_error);
+    ASSERT_THROW(value %= FromInt(0, 3), std::runtime_error);
+}
@@ -0,0 +1,94 @@
+#include "../lib/number.h"
+#include "test_util.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Restores the default thread count when a test ends.
+struct ThreadCountGuard {
+    ~ThreadCountGuard() {
+        SetThreadCount(0);
+    }
+};
+
+}  // namespace
+
+class ParallelTestsSuite : public testing::TestWithParam<std::size_t> {};
+
+TEST_P(ParallelTestsSuite, MatchesSerialOperatorsForAnyThreadCount) {
+    ThreadCountGuard guard;
+    std::mt19937_64 rng(GetParam());
+    std::vector<uint239_t> lhs = RandomColumn(rng, GetParam());
+    std::vector<uint239_t> rhs = RandomColumn(rng, GetParam());
+
+    uint239_t sum = FromInt(0, 0);
+    uint239_t product = FromInt(1, 0);
+    uint239_t dot = FromInt(0, 0);
+    std::vector<uint239_t> prefix;
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        sum = sum + lhs[i];
+        product = product * lhs[i];
+        dot = dot + lhs[i] * rhs[i];
+        prefix.push_back(sum);
+    }
+
+    for (unsigned threads : {1U, 2U, 3U, 8U}) {
+        SetThreadCount(threads);
+        ASSERT_EQ(GetThreadCount(), threads);
+        ASSERT_TRUE(SameBytes(Sum(lhs), sum)) << threads;
+        ASSERT_TRUE(SameBytes(Product(lhs), product)) << threads;
+        ASSERT_TRUE(SameBytes(DotProduct(lhs, rhs), dot)) << threads;
+        std::vector<uint239_t> result(lhs.size());
+        PrefixSum(lhs, result);
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            ASSERT_TRUE(SameBytes(result[i], prefix[i])) << threads << ' ' << i;
+        }
+        if (!lhs.empty()) {
+            std::size_t min_index = 0;
+            std::size_t max_index = 0;
+            for (std::size_t i = 1; i < lhs.size(); ++i) {
+                min_index = lhs[i] < lhs[min_index] ? i : min_index;
+                max_index = lhs[max_index] < lhs[i] ? i : max_index;
+            }
+            ASSERT_TRUE(SameBytes(Min(lhs), lhs[min_index])) << threads;
+            ASSERT_TRUE(SameBytes(Max(lhs), lhs[max_index])) << threads;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Group, ParallelTestsSuite, testing::Values(0, 1, 7, 16384, 16385, 70000));
+
+TEST(ParallelTest, TiesKeepTheFirstElement) {
+    ThreadCountGuard guard;
+    SetThreadCount(4);
+    std::vector<uint239_t> values(40000, FromInt(5, 0));
+    values[20000] = FromInt(5, 7);
+    values[30000] = FromInt(5, 9);
+    values[35000] = FromInt(3, 1);
+    values[36000] = FromInt(3, 2);
+    ASSERT_EQ(GetShift(Max(values)), 0);
+    ASSERT_EQ(GetShift(Min(values)), 1);
+    values[0] = FromInt(1, 0);
+    ASSERT_EQ(GetShift(Max(values)), 0);
+    ASSERT_TRUE(SameBytes(Max(values), values[1]));
+}
+
+TEST(ParallelTest, PrefixSumInPlaceAndErrors) {
+    ThreadCountGuard guard;
+    SetThreadCount(3);
+    std::mt19937_64 rng(19);
+    std::vector<uint239_t> values = RandomColumn(rng, 40000);
+    std::vector<uint239_t> expected(values.size());
+    PrefixSum(values, expected);
+    PrefixSum(values, values);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_TRUE(SameBytes(values[i], expected[i])) << i;
+    }
+    std::vector<uint239_t> shorter(values.size() - 1);
+    ASSERT_THROW(PrefixSum(values, shorter), std::invalid_argument);
+    ASSERT_THROW(DotProduct(values, shorter), std::invalid_argument);
+    ASSERT_THROW(Min(std::span<const uint239_t>()), std::invalid_argument);
+    ASSERT_THROW(Max(std::span<const uint239_t>()), std::invalid_argument);
+}
@@ -0,0 +1,74 @@
+#include "../lib/number.h"
+#include "test_util.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct ThreadCountGuard {
+    ~ThreadCountGuard() {
+        SetThreadCount(0);
+    }
+};
+
+}  // namespace
+
+static_assert(FromInt(3, 9) <=> FromInt(5, 0) == std::weak_ordering::less);
+static_assert(FromInt(5, 9) <=> FromInt(5, 0) == std::weak_ordering::equivalent);
+static_assert(FromInt(5, 1) >= FromInt(5, 2));
+static_assert(SortKey(FromInt(0x0102, 77)).bytes[29] == 0x02 && SortKey(FromInt(0x0102, 77)).bytes[28] == 0x01);
+static_assert(SortKey(0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffff_u239).bytes[0] == 0x7f);
+
+TEST(SortTest, ThreeWayAndSortKeyAgreeWithLess) {
+    std::mt19937_64 rng(21);
+    std::vector<uint239_t> values = RandomColumn(rng, 2000, 60);
+    for (std::size_t i = 1; i < values.size(); ++i) {
+        const uint239_t& lhs = values[i - 1];
+        const uint239_t& rhs = i % 7 == 0 ? lhs << 5 : values[i];
+        std::weak_ordering expected = lhs < rhs ? std::weak_ordering::less
+                                    : rhs < lhs ? std::weak_ordering::greater
+                                                : std::weak_ordering::equivalent;
+        ASSERT_EQ(lhs <=> rhs, expected) << i;
+        ASSERT_EQ(SortKey(lhs) <=> SortKey(rhs), expected) << i;
+        int bytes = std::memcmp(SortKey(lhs).bytes, SortKey(rhs).bytes, sizeof(uint239_sort_key_t::bytes));
+        ASSERT_EQ(bytes < 0, lhs < rhs) << i;
+    }
+}
+
+class SortTestsSuite : public testing::TestWithParam<std::size_t> {};
+
+TEST_P(SortTestsSuite, MatchesStableSort) {
+    ThreadCountGuard guard;
+    std::mt19937_64 rng(GetParam());
+    for (int max_digits : {3, 17, 60}) {
+        std::vector<uint239_t> values = RandomColumn(rng, GetParam(), max_digits);
+        std::vector<uint239_t> expected = values;
+        std::stable_sort(expected.begin(), expected.end());
+        for (unsigned threads : {1U, 4U}) {
+            SetThreadCount(threads);
+            std::vector<uint239_t> sorted = values;
+            Sort(sorted);
+            for (std::size_t i = 0; i < sorted.size(); ++i) {
+                ASSERT_TRUE(SameBytes(sorted[i], expected[i])) << max_digits << ' ' << threads << ' ' << i;
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Group, SortTestsSuite, testing::Values(0, 1, 2, 255, 256, 1000, 16385, 70000));
+
+TEST(SortTest, EqualValuesKeepTheirOrderAndShifts) {
+    std::vector<uint239_t> values;
+    for (uint32_t i = 0; i < 3000; ++i) {
+        values.push_back(FromInt(i % 3, i));
+    }
+    Sort(values);
+    for (uint32_t i = 0; i < 3000; ++i) {
+        uint32_t group = i / 1000;
+        ASSERT_EQ(values[i], FromInt(group, 0)) << i;
+        ASSERT_EQ(GetShift(values[i]), (i % 1000) * 3 + group) << i;
+    }
+}
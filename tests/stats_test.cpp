@@ -0,0 +1,89 @@
+#include "../lib/number.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+
+uint64_t CallsOf(const uint239_stats& stats, uint239_op op) {
+    return stats.ops[static_cast<int>(op)].calls;
+}
+
+TEST(StatsTest, DumpsNameEveryOperation) {
+    uint239_stats stats = SnapshotStats();
+    std::string json = StatsToJson(stats);
+    ASSERT_EQ(json.front(), '{');
+    ASSERT_EQ(json.back(), '}');
+    for (int op = 0; op < kStatsOpCount; ++op) {
+        std::string name = GetOpName(static_cast<uint239_op>(op));
+        ASSERT_NE(json.find("\"" + name + "\":{\"calls\":"), std::string::npos) << name;
+    }
+    ASSERT_EQ(GetOpName(uint239_op::add_in_place), std::string("add_in_place"));
+}
+
+#if defined(BIGINT_INSTRUMENTATION)
+TEST(StatsTest, CountsCallsSinceReset) {
+    uint239_t a = FromInt(1000, 3);
+    uint239_t b = FromInt(7, 2);
+    ResetStats();
+    for (int i = 0; i < 40; ++i) {
+        a = a + b;
+    }
+    a += b;
+    ASSERT_TRUE(a > b);
+    uint239_stats stats = SnapshotStats();
+    ASSERT_EQ(CallsOf(stats, uint239_op::add), 40);
+    ASSERT_EQ(CallsOf(stats, uint239_op::add_in_place), 1);
+    ASSERT_EQ(CallsOf(stats, uint239_op::less), 1);
+    ASSERT_EQ(CallsOf(stats, uint239_op::mul), 0);
+    // a += b works on the stored bits and does not go through the codec.
+    ASSERT_GE(CallsOf(stats, uint239_op::decode), 80);
+    ASSERT_GE(CallsOf(stats, uint239_op::encode), 40);
+
+    const uint239_op_stats& add = stats.ops[static_cast<int>(uint239_op::add)];
+    uint64_t histogram_total = 0;
+    for (uint64_t count : add.histogram) {
+        histogram_total += count;
+    }
+    ASSERT_GT(add.samples, 0);
+    ASSERT_EQ(histogram_total, add.samples);
+    ASSERT_NE(StatsToText(stats).find("add_in_place"), std::string::npos);
+
+    ResetStats();
+    ASSERT_EQ(CallsOf(SnapshotStats(), uint239_op::add), 0);
+}
+
+TEST(StatsTest, SumsThreadsIncludingExitedOnes) {
+    ResetStats();
+    std::thread worker([] {
+        uint239_t value = FromInt(5, 0);
+        for (int i = 0; i < 10; ++i) {
+            value = value * value;
+        }
+    });
+    worker.join();
+    uint239_t local = FromInt(3, 0);
+    local = local * local;
+    ASSERT_EQ(CallsOf(SnapshotStats(), uint239_op::mul), 11);
+}
+
+TEST(StatsTest, ToStringCountsOnce) {
+    ResetStats();
+    ASSERT_EQ(ToString(FromInt(1234, 0)), "1234");
+    uint239_stats stats = SnapshotStats();
+    ASSERT_EQ(CallsOf(stats, uint239_op::to_string), 1);
+    ASSERT_EQ(CallsOf(stats, uint239_op::to_chars), 0);
+}
+
+TEST(StatsTest, ConstantEvaluationIsNotCounted) {
+    ResetStats();
+    constexpr uint239_t kProduct = FromInt(6, 0) * FromInt(7, 0);
+    static_assert(kProduct == FromInt(42, 0));
+    ASSERT_EQ(CallsOf(SnapshotStats(), uint239_op::mul), 0);
+}
+#else
+TEST(StatsTest, CompiledOutByDefault) {
+    FromInt(2, 0) + FromInt(3, 0);
+    ASSERT_EQ(CallsOf(SnapshotStats(), uint239_op::add), 0);
+    ASSERT_EQ(StatsToText(SnapshotStats()).find("add"), std::string::npos);
+}
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+// Fixtures shared by the test files: random operands built through the public parser
+// and a byte-exact comparison.
+#include "../lib/number.h"
+#include <cstring>
+#include <random>
+#include <vector>
+
+// A value of 1 to max_digits hex digits, below 2^239, under a random shift.
+inline uint239_t RandomValue(std::mt19937_64& rng, int max_digits = 60) {
+    char hex[60];
+    int digits = 1 + static_cast<int>(rng() % max_digits);
+    for (int i = 0; i < digits; ++i) {
+        hex[i] = "0123456789abcdef"[i == 0 && digits == 60 ? rng() % 8 : rng() % 16];
+    }
+    uint239_t value{};
+    FromChars(hex, hex + digits, value, static_cast<uint32_t>(rng() >> 29), 16);
+    return value;
+}
+
+inline std::vector<uint239_t> RandomColumn(std::mt19937_64& rng, std::size_t size, int max_digits = 60) {
+    std::vector<uint239_t> column(size);
+    for (uint239_t& value : column) {
+        value = RandomValue(rng, max_digits);
+    }
+    return column;
+}
+
+inline bool SameBytes(const uint239_t& lhs, const uint239_t& rhs) {
+    return std::memcmp(lhs.data, rhs.data, sizeof(lhs.data)) == 0;
+}
+
+// The exact value in a type wide enough for a full product.
+inline uint_t<479> Widen(const uint239_t& value) {
+    uint_t<479> wide{};
+    FromChars(ToString(value), wide, 0);
+    return wide;
+}
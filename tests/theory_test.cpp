@@ -0,0 +1,120 @@
+#include "../lib/number.h"
+#include "test_util.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+namespace {
+
+uint239_t EuclidGcd(uint239_t a, uint239_t b) {
+    while (b != 0_u239) {
+        uint239_t remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+}  // namespace
+
+constexpr uint239_t kTop = 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffff_u239;
+
+static_assert(Pow(3_u239, 150) == 0x359ba2b98ca11d6864a331b45ae7114c01ffbdcf60cc16e692fb63c6e219_u239);
+static_assert(Pow(2_u239, 239) == 0_u239);
+static_assert(Pow(kTop, 0) == 1_u239);
+static_assert(GetShift(Pow(FromInt(5, 3), 4)) == 12);
+static_assert(Gcd(12_u239, 18_u239) == 6_u239);
+static_assert(Gcd(0_u239, 0_u239) == 0_u239);
+static_assert(Lcm(4_u239, 6_u239) == 12_u239);
+static_assert(Isqrt(kTop) == 0xb504f333f9de6484597d89b3754abe_u239);
+static_assert(ExtGcd(240_u239, 46_u239).gcd == 2_u239);
+
+TEST(TheoryTest, PowMatchesRepeatedMultiplication) {
+    std::mt19937_64 rng(18);
+    uint_t<479> limit = Widen(kTop);
+    for (int i = 0; i < 300; ++i) {
+        uint239_t base = RandomValue(rng, 1 + static_cast<int>(rng() % 12));
+        uint64_t exponent = rng() % 80;
+        uint239_t expected = FromInt(1, 0);
+        uint_t<479> exact = FromInt<479>(1, 0);
+        bool exact_overflow = false;
+        for (uint64_t k = 0; k < exponent; ++k) {
+            expected = expected * base;
+            if (!exact_overflow) {
+                exact = exact * Widen(base);
+                exact_overflow = exact > limit;
+            }
+        }
+        bool overflow = false;
+        uint239_t power = Pow(base, exponent, overflow);
+        ASSERT_EQ(power, expected) << i;
+        ASSERT_EQ(GetShift(power), GetShift(expected)) << i;
+        ASSERT_EQ(overflow, exact_overflow) << i;
+    }
+}
+
+TEST(TheoryTest, PowOverflowBoundary) {
+    bool overflow = true;
+    ASSERT_EQ(Pow(2_u239, 238, overflow), kTop / 2_u239 + 1_u239);
+    ASSERT_FALSE(overflow);
+    Pow(2_u239, 239, overflow);
+    ASSERT_TRUE(overflow);
+    Pow(1_u239, ~0ULL, overflow);
+    ASSERT_FALSE(overflow);
+    Pow(0_u239, ~0ULL, overflow);
+    ASSERT_FALSE(overflow);
+}
+
+TEST(TheoryTest, GcdLcmAndExtGcd) {
+    std::mt19937_64 rng(46);
+    for (int i = 0; i < 2000; ++i) {
+        uint239_t a = RandomValue(rng);
+        uint239_t b = RandomValue(rng);
+        if (i % 4 == 0) {
+            uint239_t factor = RandomValue(rng, 20);
+            a = RandomValue(rng, 20) * factor;
+            b = RandomValue(rng, 20) * factor;
+        }
+        uint239_t gcd = Gcd(a, b);
+        ASSERT_EQ(gcd, EuclidGcd(a, b)) << i;
+        ASSERT_EQ(GetShift(gcd), 0);
+        if (gcd != 0_u239) {
+            ASSERT_EQ(Lcm(a, b), a / gcd * b) << i;
+        }
+
+        uint239_ext_gcd_t ext = ExtGcd(a, b);
+        ASSERT_EQ(ext.gcd, gcd) << i;
+        ASSERT_FALSE(ext.x_negative && ext.y_negative) << i;
+        uint_t<479> lhs = Widen(a) * Widen(ext.x);
+        uint_t<479> rhs = Widen(b) * Widen(ext.y);
+        uint_t<479> combined = ext.x_negative ? rhs - lhs : ext.y_negative ? lhs - rhs : lhs + rhs;
+        ASSERT_EQ(combined, Widen(gcd)) << i;
+        if (a != 0_u239 && b != 0_u239) {
+            ASSERT_FALSE(b / gcd < ext.x) << i;
+            ASSERT_FALSE(a / gcd < ext.y) << i;
+        }
+    }
+    ASSERT_EQ(ExtGcd(7_u239, 0_u239).x, 1_u239);
+    ASSERT_EQ(ExtGcd(0_u239, 7_u239).y, 1_u239);
+    ASSERT_EQ(Lcm(0_u239, 7_u239), 0_u239);
+}
+
+TEST(TheoryTest, IsqrtBracketsTheRoot) {
+    std::mt19937_64 rng(2);
+    for (int i = 0; i < 2000; ++i) {
+        uint239_t value = RandomValue(rng);
+        uint239_t root = Isqrt(value);
+        uint_t<479> low = Widen(root) * Widen(root);
+        uint_t<479> high = (Widen(root) + FromInt<479>(1, 0)) * (Widen(root) + FromInt<479>(1, 0));
+        ASSERT_FALSE(Widen(value) < low) << i;
+        ASSERT_TRUE(Widen(value) < high) << i;
+        ASSERT_EQ(GetShift(root), 0);
+    }
+    for (uint32_t n = 0; n < 1000; ++n) {
+        uint32_t root = 0;
+        while ((root + 1) * (root + 1) <= n) {
+            ++root;
+        }
+        ASSERT_EQ(Isqrt(FromInt(n, n)), FromInt(root, 0)) << n;
+    }
+}
@@ -0,0 +1,156 @@
+#include "../lib/number.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <string>
+
+
+namespace {
+
+template <int Bits>
+uint_t<Bits> RandomValue(std::mt19937_64& rng, int max_bits = Bits) {
+    std::string hex;
+    int bits = 1 + static_cast<int>(rng() % max_bits);
+    hex += "0123456789abcdef"[1 << ((bits - 1) % 4)];
+    for (int i = 0; i < (bits - 1) / 4; ++i) {
+        hex += "0123456789abcdef"[rng() % 16];
+    }
+    uint_t<Bits> value{};
+    EXPECT_EQ(FromChars(hex, value, rng(), 16).ec, std::errc());
+    return value;
+}
+
+template <int Bits>
+bool SameBytes(const uint_t<Bits>& lhs, const uint_t<Bits>& rhs) {
+    return std::memcmp(lhs.data, rhs.data, sizeof(lhs.data)) == 0;
+}
+
+std::string ToHex(unsigned __int128 value) {
+    std::string hex;
+    do {
+        hex.insert(hex.begin(), "0123456789abcdef"[static_cast<int>(value & 15)]);
+        value >>= 4;
+    } while (value != 0);
+    return hex;
+}
+
+}  // namespace
+
+static_assert(sizeof(uint_t<127>) == 19 && sizeof(uint_t<479>) == 69 && sizeof(uint_t<1023>) == 147);
+static_assert(bigint_impl::_uintLayout<127>::kTopShiftWordMask == (1ULL << 19) - 1 && bigint_impl::_uintLayout<1023>::kShiftWords == 3);
+static_assert(FromInt<127>(6, 3) * FromInt<127>(7, 4) == FromInt<127>(42, 0));
+static_assert(GetShift(FromInt<1023>(6, 3) * FromInt<1023>(7, 4)) == 7);
+static_assert(FromString<479>("1000000000000000000000000000000", 0) / FromInt<479>(1000, 0) ==
+              FromString<479>("1000000000000000000000000000", 0));
+
+TEST(UintTest, GenericEngineMatchesUint239ByteForByte) {
+    std::mt19937_64 rng(239);
+    for (int i = 0; i < 2000; ++i) {
+        uint239_t a = RandomValue<239>(rng);
+        uint239_t b = RandomValue<239>(rng, 1 + static_cast<int>(rng() % 239));
+        ASSERT_TRUE(SameBytes(bigint_impl::_uintAdd(a, b), a + b)) << i;
+        ASSERT_TRUE(SameBytes(bigint_impl::_uintSub(a, b), a - b)) << i;
+        ASSERT_TRUE(SameBytes(bigint_impl::_uintMul(a, b), a * b)) << i;
+        uint239_divmod_t generic = bigint_impl::_uintDivMod(a, b);
+        ASSERT_TRUE(SameBytes(generic.quotient, a / b)) << i;
+        ASSERT_TRUE(SameBytes(generic.remainder, a % b)) << i;
+        ASSERT_EQ(bigint_impl::_uintLess(a, b), a < b) << i;
+        ASSERT_EQ(bigint_impl::_uintEqual(a, b), a == b) << i;
+    }
+}
+
+TEST(UintTest, Uint127MatchesInt128Arithmetic) {
+    std::mt19937_64 rng(127);
+    const unsigned __int128 mask = (static_cast<unsigned __int128>(1) << 127) - 1;
+    for (int i = 0; i < 2000; ++i) {
+        uint_t<127> a = RandomValue<127>(rng);
+        uint_t<127> b = RandomValue<127>(rng, 1 + static_cast<int>(rng() % 127));
+        unsigned __int128 x = 0;
+        unsigned __int128 y = 0;
+        for (char digit : ToString(a, 16)) x = x * 16 + bigint_impl::_digitValue(digit);
+        for (char digit : ToString(b, 16)) y = y * 16 + bigint_impl::_digitValue(digit);
+        ASSERT_EQ(ToString(a + b, 16), ToHex((x + y) & mask)) << i;
+        ASSERT_EQ(ToString(a - b, 16), ToHex((x - y) & mask)) << i;
+        ASSERT_EQ(ToString(a * b, 16), ToHex((x * y) & mask)) << i;
+        ASSERT_EQ(ToString(a / b, 16), ToHex(x / y)) << i;
+        ASSERT_EQ(ToString(a % b, 16), ToHex(x % y)) << i;
+        ASSERT_EQ(a < b, x < y) << i;
+        ASSERT_EQ(GetShift(a + b), (GetShift(a) + GetShift(b)) & ((1ULL << 19) - 1)) << i;
+    }
+}
+
+template <int Bits>
+void CheckIdentities(uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    for (int i = 0; i < 500; ++i) {
+        uint_t<Bits> a = RandomValue<Bits>(rng);
+        uint_t<Bits> b = RandomValue<Bits>(rng, 1 + static_cast<int>(rng() % Bits));
+        uint_t<Bits> half = RandomValue<Bits>(rng, Bits / 2 - 1);
+        uint_t<Bits> other_half = RandomValue<Bits>(rng, Bits / 2 - 1);
+        ASSERT_EQ(a - b + b, a) << i;
+        ASSERT_EQ(half * other_half / other_half, half) << i;
+        uint_divmod_t<Bits> result = DivMod(a, b);
+        ASSERT_EQ(result.quotient * b + result.remainder, a) << i;
+        ASSERT_TRUE(result.remainder < b) << i;
+        ASSERT_TRUE(SameBytes((a << 12345) >> 12345, a)) << i;
+        for (int base : {10, 36}) {
+            uint_t<Bits> parsed{};
+            std::string text = ToString(a, base);
+            ASSERT_EQ(FromChars(text, parsed, 0, base).ec, std::errc());
+            ASSERT_EQ(parsed, a) << text;
+        }
+        uint_t<Bits> sum = a;
+        sum += b;
+        ASSERT_TRUE(SameBytes(sum, a + b)) << i;
+    }
+}
+
+TEST(UintTest, Uint479Identities) {
+    CheckIdentities<479>(479);
+}
+
+TEST(UintTest, Uint1023Identities) {
+    CheckIdentities<1023>(1023);
+}
+
+TEST(UintTest, OddWidthsIdentities) {
+    CheckIdentities<64>(64);
+    CheckIdentities<65>(65);
+    CheckIdentities<200>(200);
+}
+
+TEST(UintTest, ShiftUsesEveryServiceBit) {
+    uint_t<127> narrow = FromInt<127>(5, (1ULL << 19) + 3);
+    ASSERT_EQ(GetShift(narrow), 3);
+
+    uint_t<1023> zero_shift = FromInt<1023>(5, 0);
+    uint_t<1023> wide = FromInt<1023>(5, ~0ULL);
+    ASSERT_EQ(GetShift(wide), ~0ULL);
+    uint_t<1023> carried = wide << 1;
+    ASSERT_EQ(GetShift(carried), 0);
+    ASSERT_FALSE(SameBytes(carried, zero_shift));
+    ASSERT_TRUE(SameBytes(carried >> 1, wide));
+    ASSERT_EQ(carried, zero_shift);
+
+    // 0 - 1 wraps at all 147 shift bits, so every service bit ends up set.
+    uint_t<1023> wrapped = zero_shift >> 1;
+    for (uint8_t byte : wrapped.data) {
+        ASSERT_NE(byte & 0x80, 0);
+    }
+    ASSERT_EQ(GetShift(wrapped), ~0ULL);
+    ASSERT_EQ(wrapped, zero_shift);
+    ASSERT_TRUE(SameBytes(wrapped << 1, zero_shift));
+    // (2^147 - 1) + 2^64 is 2^64 - 1 modulo 2^147.
+    ASSERT_TRUE(SameBytes(wrapped + carried, FromInt<1023>(10, ~0ULL)));
+}
+
+TEST(UintTest, RangeAndErrors) {
+    uint_t<127> value{};
+    std::string max = "170141183460469231731687303715884105727";
+    ASSERT_EQ(FromChars(max, value, 0).ec, std::errc());
+    ASSERT_EQ(ToString(value), max);
+    ASSERT_EQ(FromChars("170141183460469231731687303715884105728", value, 0).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(ToString(value + FromInt<127>(1, 0)), "0");
+    ASSERT_THROW(value / FromInt<127>(0, 0), std::runtime_error);
+    ASSERT_THROW(ToString(value, 1), std::invalid_argument);
+}
@@ -0,0 +1,38 @@
+#include "../lib/number.h"
+#include "test_util.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+constexpr uint239_t kTop = 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffff_u239;
+
+static_assert(MulWide(kTop, kTop).low == 1_u239);
+static_assert(MulWide(kTop, kTop).high == kTop - 1_u239);
+static_assert(MulHigh(2_u239, 3_u239) == 0_u239);
+static_assert(MulAdd(kTop, kTop, kTop).low == 0_u239);
+static_assert(MulAdd(kTop, kTop, kTop).high == kTop);
+static_assert(GetShift(MulAdd(FromInt(2, 3), FromInt(3, 4), FromInt(1, 5)).high) == 12);
+
+TEST(WideTest, MatchesExactProduct) {
+    std::mt19937_64 rng(478);
+    uint_t<479> two_to_239 = Widen(kTop) + FromInt<479>(1, 0);
+    for (int i = 0; i < 3000; ++i) {
+        uint239_t a = RandomValue(rng);
+        uint239_t b = RandomValue(rng);
+        uint239_t c = RandomValue(rng);
+        uint_t<479> product = Widen(a) * Widen(b);
+        uint_t<479> fused = product + Widen(c);
+
+        uint239_wide_t wide = MulWide(a, b);
+        ASSERT_EQ(Widen(wide.high), product / two_to_239) << i;
+        ASSERT_EQ(Widen(wide.low), product % two_to_239) << i;
+        ASSERT_TRUE(SameBytes(wide.low, a * b)) << i;
+        ASSERT_EQ(GetShift(wide.high), GetShift(a * b)) << i;
+        ASSERT_TRUE(SameBytes(MulHigh(a, b), wide.high)) << i;
+
+        uint239_wide_t sum = MulAdd(a, b, c);
+        ASSERT_EQ(Widen(sum.high), fused / two_to_239) << i;
+        ASSERT_TRUE(SameBytes(sum.low, a * b + c)) << i;
+        ASSERT_EQ(GetShift(sum.high), GetShift(a * b + c)) << i;
+    }
+}
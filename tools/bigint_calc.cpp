@@ -0,0 +1,139 @@
+// bigint_calc: evaluates "<op> <lhs> <rhs>" lines (see bigint_calc.h) from the files on
+// the command line, or stdin, and writes one result line per input line to stdout.
+//
+//   bigint_calc [--hex] [--threads N] [--quiet] [FILE...]
+//
+// Input is read in chunks of about 1 MiB cut at line ends. A batch of chunks is evaluated
+// on the library's thread pool, one chunk per task, and the outputs are written in chunk
+// order, so the output lines stay in input order. The throughput goes to stderr at the
+// end unless --quiet is given. Exits with 1 when a line failed and 2 on usage or I/O errors.
+#include "bigint_calc.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr std::size_t kCalcChunkBytes = 1 << 20;
+constexpr std::size_t kCalcChunksPerThread = 4;
+
+struct calc_input {
+	std::FILE* file = nullptr;
+	std::string carry;
+	bool done = false;
+};
+
+// Fills chunk with whole lines from input; false once input has nothing left. A last line
+// without '\n' gets one, and a line longer than a chunk makes the chunk longer.
+bool _readChunk(calc_input& input, calc_chunk& chunk) {
+	chunk.input = std::move(input.carry);
+	input.carry.clear();
+	while (!input.done) {
+		std::size_t size = chunk.input.size();
+		chunk.input.resize(size + kCalcChunkBytes);
+		std::size_t read = std::fread(chunk.input.data() + size, 1, kCalcChunkBytes, input.file);
+		chunk.input.resize(size + read);
+		if (read < kCalcChunkBytes) {
+			input.done = true;
+			break;
+		}
+		std::size_t last_line_end = chunk.input.rfind('\n');
+		if (last_line_end != std::string::npos && last_line_end >= size) {
+			input.carry.assign(chunk.input, last_line_end + 1);
+			chunk.input.resize(last_line_end + 1);
+			return true;
+		}
+	}
+	if (chunk.input.empty()) {
+		return false;
+	}
+	if (chunk.input.back() != '\n') {
+		chunk.input.push_back('\n');
+	}
+	return true;
+}
+
+int _usage() {
+	std::fputs("usage: bigint_calc [--hex] [--threads N] [--quiet] [FILE...]\n", stderr);
+	return 2;
+}
+
+int main(int argc, char** argv) {
+	int base = 10;
+	bool quiet = false;
+	std::vector<const char*> paths;
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--hex") == 0) {
+			base = 16;
+		} else if (std::strcmp(argv[i], "--quiet") == 0) {
+			quiet = true;
+		} else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			unsigned threads = 0;
+			const char* value = argv[++i];
+			auto [end, error] = std::from_chars(value, value + std::strlen(value), threads);
+			if (error != std::errc() || *end != '\0') {
+				return _usage();
+			}
+			SetThreadCount(threads);
+		} else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+			return _usage();
+		} else {
+			paths.push_back(argv[i]);
+		}
+	}
+	if (paths.empty()) {
+		paths.push_back("-");
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::size_t lines = 0;
+	std::size_t errors = 0;
+	std::size_t bytes = 0;
+	std::vector<calc_chunk> batch(GetThreadCount() * kCalcChunksPerThread);
+	for (const char* path : paths) {
+		calc_input input;
+		bool standard = std::strcmp(path, "-") == 0;
+		input.file = standard ? stdin : std::fopen(path, "rb");
+		if (input.file == nullptr) {
+			std::fprintf(stderr, "bigint_calc: cannot open %s: %s\n", path, std::strerror(errno));
+			return 2;
+		}
+		bool more = true;
+		while (more) {
+			std::size_t filled = 0;
+			while (filled < batch.size() && (more = _readChunk(input, batch[filled]))) {
+				++filled;
+			}
+			auto body = [&](std::size_t chunk) { _calcChunk(batch[chunk], base); };
+			bigint_impl::_parallelFor(filled, body);
+			for (std::size_t chunk = 0; chunk < filled; ++chunk) {
+				std::fwrite(batch[chunk].output.data(), 1, batch[chunk].output.size(), stdout);
+				lines += batch[chunk].lines;
+				errors += batch[chunk].errors;
+				bytes += batch[chunk].input.size();
+			}
+		}
+		bool failed = std::ferror(input.file) != 0;
+		if (!standard) {
+			std::fclose(input.file);
+		}
+		if (failed) {
+			std::fprintf(stderr, "bigint_calc: cannot read %s\n", path);
+			return 2;
+		}
+	}
+	if (std::fflush(stdout) != 0) {
+		std::fputs("bigint_calc: cannot write the output\n", stderr);
+		return 2;
+	}
+
+	if (!quiet) {
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		seconds = seconds > 0 ? seconds : 1e-9;
+		std::fprintf(stderr, "bigint_calc: %zu lines, %zu errors in %.3f s: %.2f M lines/s, %.1f MB/s on %u threads\n",
+		             lines, errors, seconds, lines / seconds / 1e6, bytes / seconds / 1e6, GetThreadCount());
+	}
+	return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+#pragma once
+// Line evaluation for the bigint_calc tool, apart from main() so the tests can drive it.
+// An input line is "<op> <lhs> <rhs>" with op one of add, sub, mul, div and mod. Operands
+// are decimal, or hexadecimal after 0x, with an optional shift below 2^35 after '@': 0xff@3
+// is 255 with shift 3. Every input line gives one output line: the result in the same form,
+// its full 35-bit shift after '@' when it is not zero, or "error: <reason>". Blank lines
+// stay blank, so output line n always answers input line n.
+#include "../lib/number.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// A run of whole lines, each ending in '\n', and what evaluating them gave.
+struct calc_chunk {
+	std::string input;
+	std::string output;
+	std::size_t lines = 0;
+	std::size_t errors = 0;
+};
+
+// nullptr on success, the reason otherwise.
+inline const char* _calcOperand(std::string_view token, uint239_t& value) {
+	const char* first = token.data();
+	const char* last = first + token.size();
+	const char* at = std::find(first, last, '@');
+	std::uint64_t shift = 0;
+	if (at != last) {
+		auto [end, error] = std::from_chars(at + 1, last, shift);
+		if (at + 1 == last || error != std::errc() || end != last || shift > bigint_impl::kShiftMask35) {
+			return "bad shift";
+		}
+	}
+	int base = 10;
+	if (at - first > 2 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X')) {
+		base = 16;
+		first += 2;
+	}
+	auto [end, error] = FromChars(first, at, value, 0, base);
+	if (error == std::errc::result_out_of_range) {
+		return "operand out of range";
+	}
+	if (error != std::errc() || end != at) {
+		return "bad operand";
+	}
+	value = bigint_impl::_withShift(value, shift);
+	return nullptr;
+}
+
+inline bool _calcFormat(const uint239_t& value, int base, std::string& output) {
+	char buffer[256];
+	char* end = buffer;
+	if (base == 16) {
+		*end++ = '0';
+		*end++ = 'x';
+	}
+	end = ToChars(end, buffer + sizeof(buffer), value, base).ptr;
+	std::uint64_t shift = bigint_impl::_loadShift(value);
+	if (shift != 0) {
+		*end++ = '@';
+		end = std::to_chars(end, buffer + sizeof(buffer), shift).ptr;
+	}
+	*end++ = '\n';
+	output.append(buffer, end);
+	return 0;
+}
+
+// Evaluates one line without its '\n' and appends the result line; nullptr on success.
+inline const char* _calcLine(std::string_view line, int base, std::string& output) {
+	std::string_view tokens[3];
+	int count = 0;
+	std::size_t position = 0;
+	while (true) {
+		position = line.find_first_not_of(" \t", position);
+		if (position == std::string_view::npos) {
+			break;
+		}
+		if (count == 3) {
+			return "expected <op> <lhs> <rhs>";
+		}
+		std::size_t end = std::min(line.find_first_of(" \t", position), line.size());
+		tokens[count++] = line.substr(position, end - position);
+		position = end;
+	}
+	if (count == 0) {
+		output.push_back('\n');
+		return nullptr;
+	}
+	if (count != 3) {
+		return "expected <op> <lhs> <rhs>";
+	}
+	uint239_t lhs{};
+	uint239_t rhs{};
+	if (const char* error = _calcOperand(tokens[1], lhs)) {
+		return error;
+	}
+	if (const char* error = _calcOperand(tokens[2], rhs)) {
+		return error;
+	}
+	std::string_view op = tokens[0];
+	uint239_t result{};
+	if (op == "add") {
+		result = lhs + rhs;
+	} else if (op == "sub") {
+		result = lhs - rhs;
+	} else if (op == "mul") {
+		result = lhs * rhs;
+	} else if (op == "div" || op == "mod") {
+		if (rhs == FromInt(0, 0)) {
+			return "division by zero";
+		}
+		result = op == "div" ? lhs / rhs : lhs % rhs;
+	} else {
+		return "unknown operation";
+	}
+	_calcFormat(result, base, output);
+	return nullptr;
+}
+
+inline bool _calcChunk(calc_chunk& chunk, int base) {
+	chunk.output.clear();
+	chunk.lines = 0;
+	chunk.errors = 0;
+	chunk.output.reserve(chunk.input.size());
+	std::string_view input = chunk.input;
+	while (!input.empty()) {
+		std::size_t end = input.find('\n');
+		std::string_view line = input.substr(0, end);
+		input.remove_prefix(end == std::string_view::npos ? input.size() : end + 1);
+		if (!line.empty() && line.back() == '\r') {
+			line.remove_suffix(1);
+		}
+		++chunk.lines;
+		if (const char* error = _calcLine(line, base, chunk.output)) {
+			chunk.output.append("error: ").append(error).push_back('\n');
+			++chunk.errors;
+		}
+	}
+	return 0;
+}